@@ -46,6 +46,23 @@
 ******************************************************************************
 */
 #include "platform1.h"
+#include "st_errno.h"
+
+/*
+******************************************************************************
+* GLOBAL DEFINES
+******************************************************************************
+*/
+#define RFAL_CRC_A_PRESET          0x6363   /*!< CRC_A preset value  ISO14443-3 Annex B */
+#define RFAL_CRC_B_PRESET          0xFFFF   /*!< CRC_B preset value  ISO14443-3 Annex B */
+#define RFAL_CRC_LEN               2        /*!< CRC_A / CRC_B length                   */
+
+/*
+******************************************************************************
+* GLOBAL MACROS
+******************************************************************************
+*/
+#define rfalCrcParityFrameLen( len )   ((((uint32_t)(len) * 9) + 7) / 8)   /*!< Bytes needed to hold len bytes each followed by its parity bit */
 
 /*
 ******************************************************************************
@@ -71,5 +88,85 @@
  */
 extern uint16_t rfalCrcCalculateCcitt(uint16_t preloadValue, const uint8_t* buf, uint16_t length);
 
+/*! 
+ *****************************************************************************
+ *  \brief  Calculate CRC_A
+ *
+ *  Table driven calculation of the ISO14443A CRC_A (preset 0x6363) over 
+ *  \a length bytes of \a buf.
+ *  The LSB of the result is the first byte to be transmitted.
+ *
+ *  \param[in] buf : buffer to calculate the CRC for.
+ *  \param[in] length : size of the buffer.
+ *
+ *  \return 16 bit long CRC_A value.
+ *
+ *****************************************************************************
+ */
+extern uint16_t rfalCrcCalculateCrcA(const uint8_t* buf, uint16_t length);
+
+/*! 
+ *****************************************************************************
+ *  \brief  Calculate CRC_B
+ *
+ *  Table driven calculation of the ISO14443B CRC_B (preset 0xFFFF, 
+ *  complemented) over \a length bytes of \a buf.
+ *  The LSB of the result is the first byte to be transmitted.
+ *
+ *  \param[in] buf : buffer to calculate the CRC for.
+ *  \param[in] length : size of the buffer.
+ *
+ *  \return 16 bit long CRC_B value.
+ *
+ *****************************************************************************
+ */
+extern uint16_t rfalCrcCalculateCrcB(const uint8_t* buf, uint16_t length);
+
+/*! 
+ *****************************************************************************
+ *  \brief  Encode bytes with odd parity
+ *
+ *  Builds the bit stream of an ISO14443A frame: each byte of \a buf is
+ *  placed LSB first followed by its odd parity bit. The stream is packed 
+ *  LSB first on \a outBuf, the last byte is padded with zeros.
+ *
+ *  \param[in]  buf : bytes to be encoded.
+ *  \param[in]  length : number of bytes to be encoded.
+ *  \param[out] outBuf : buffer for the encoded stream.
+ *  \param[in]  outBufLen : size of \a outBuf, at least rfalCrcParityFrameLen(length).
+ *  \param[out] outBits : number of bits of the encoded stream.
+ *
+ *  \return ERR_PARAM : Invalid parameters
+ *  \return ERR_NOMEM : \a outBuf too small
+ *  \return ERR_NONE  : No error
+ *
+ *****************************************************************************
+ */
+extern ReturnCode rfalCrcParityEncode(const uint8_t* buf, uint16_t length, uint8_t* outBuf, uint16_t outBufLen, uint16_t* outBits);
+
+/*! 
+ *****************************************************************************
+ *  \brief  Decode and check odd parity bytes
+ *
+ *  Reverses rfalCrcParityEncode(): takes every 9 bits of the LSB first 
+ *  stream \a buf as a data byte followed by its parity bit. All the complete 
+ *  bytes are decoded even if parity errors are found.
+ *
+ *  \param[in]  buf : encoded bit stream.
+ *  \param[in]  bits : number of bits of the stream.
+ *  \param[out] outBuf : buffer for the decoded bytes.
+ *  \param[in]  outBufLen : size of \a outBuf.
+ *  \param[out] outLen : number of bytes decoded.
+ *
+ *  \return ERR_PARAM           : Invalid parameters
+ *  \return ERR_NOMEM           : \a outBuf too small
+ *  \return ERR_PAR             : Parity error detected
+ *  \return ERR_INCOMPLETE_BYTE : The stream doesn't end on a byte boundary
+ *  \return ERR_NONE            : No error
+ *
+ *****************************************************************************
+ */
+extern ReturnCode rfalCrcParityDecode(const uint8_t* buf, uint16_t bits, uint8_t* outBuf, uint16_t outBufLen, uint16_t* outLen);
+
 #endif /* RFAL_CRC_H_ */
 
@@ -83,6 +83,7 @@
 #define ISO15693_DAT_SLOT1_1_256 0x08
 #define ISO15693_DAT_SLOT2_1_256 0x20
 #define ISO15693_DAT_SLOT3_1_256 0x80
+#define ISO15693_DAT_LEN_1_256   64   /* Coded length of a data byte in 1of256: 256 slots of 2 bits */
 
 #define ISO15693_PHY_DAT_MANCHESTER_1 0xaaaa
 
@@ -104,7 +105,8 @@ static iso15693PhyConfig_t iso15693PhyConfig; /*!< current phy configuration */
 ******************************************************************************
 */
 static ReturnCode iso15693PhyVCDCode1Of4(const uint8_t data, uint8_t* outbuf, uint16_t maxOutBufLen, uint16_t* outBufLen);
-static ReturnCode iso15693PhyVCDCode1Of256(const uint8_t data, uint8_t* outbuf, uint16_t maxOutBufLen, uint16_t* outBufLen);
+static ReturnCode iso15693PhyVCDCode1Of256(const uint8_t* buffer, uint16_t length, const uint8_t* crc, uint8_t crcLen, uint16_t* offset, uint8_t* outbuf, uint16_t outBufSize, uint16_t* actOutBufSize);
+static uint16_t iso15693PhyVCDCrc(const uint8_t* buffer, uint16_t length, bool picopassMode);
 
 static struct iso15693StreamConfig stream_config = {
     .useBPSK = 0, /* 0: subcarrier, 1:BPSK */
@@ -171,7 +173,7 @@ ReturnCode iso15693VCDCode(uint8_t* buffer, uint16_t length, bool sendCrc, bool
     {
         sof = ISO15693_DAT_SOF_1_256;
         eof = ISO15693_DAT_EOF_1_256;
-        txFunc = iso15693PhyVCDCode1Of256;
+        txFunc = NULL;
         *subbit_total_length = (
                 ( 1  /* SOF */
                   + (length + crc_len) * 64 
@@ -180,7 +182,7 @@ ReturnCode iso15693VCDCode(uint8_t* buffer, uint16_t length, bool sendCrc, bool
 
         if (*offset)
         {
-            if (outBufSize < 64)  /* 64 should be safe: enough a single byte data in 1of256 */
+            if ((*offset < (length + crc_len)) && (outBufSize < ISO15693_DAT_LEN_1_256))  /* enough a single byte data in 1of256, unless only EOF is left */
                 return ERR_NOMEM;
         }
         else
@@ -212,6 +214,19 @@ ReturnCode iso15693VCDCode(uint8_t* buffer, uint16_t length, bool sendCrc, bool
         outbuf++;
     }
 
+    /* In 1of256 as much of the frame as fits is coded at once */
+    if (txFunc == NULL)
+    {
+        if (sendCrc)
+        {
+            crc = iso15693PhyVCDCrc(buffer, length, picopassMode);
+            transbuf[0] = crc & 0xff;
+            transbuf[1] = (crc >> 8) & 0xff;
+        }
+        
+        return iso15693PhyVCDCode1Of256(buffer, length, transbuf, crc_len, offset, outbuf, outBufSize, actOutBufSize);
+    }
+
     while (*offset < length && err == ERR_NONE)
     {
         uint16_t filled_size;
@@ -229,11 +244,7 @@ ReturnCode iso15693VCDCode(uint8_t* buffer, uint16_t length, bool sendCrc, bool
         uint16_t filled_size;
         if (0==crc)
         {
-            crc = rfalCrcCalculateCcitt( ((picopassMode) ? 0xE012 : 0xFFFF),         /* In PicoPass Mode a different Preset Value is used   */
-                                         ((picopassMode) ? (buffer + 1) : buffer),   /* CMD byte is not taken into account in PicoPass mode */
-                                         ((picopassMode) ? (length - 1) : length));  /* CMD byte is not taken into account in PicoPass mode */
-            
-            crc = ((picopassMode) ? crc : ~crc);
+            crc = iso15693PhyVCDCrc(buffer, length, picopassMode);
         }
         /* send crc */
         transbuf[0] = crc & 0xff;
@@ -435,58 +446,82 @@ static ReturnCode iso15693PhyVCDCode1Of4(const uint8_t data, uint8_t* outbuf, ui
 
 /*! 
  *****************************************************************************
- *  \brief  Perform 1 of 256 coding and send coded data
+ *  \brief  Perform 1 of 256 coding of a frame
  *
- *  This function takes \a length bytes from \a buffer, perform 1 of 256 coding
- *  (see ISO15693-2 specification) and sends the data using stream mode.
- *  \note This function sends SOF prior to the data.
+ *  This function codes the bytes of \a buffer followed by \a crc from 
+ *  \a offset (see ISO15693-2 specification), followed by EOF.
+ *  The output region is zero filled at once and a single byte is set per
+ *  data byte. If the whole frame does not fit, as many bytes as fit are 
+ *  coded and the rest is left for the next call.
+ *  \note SOF is sent by the caller.
  *
- *  \param[in] sendSof : send SOF prior to data.
  *  \param[in] buffer : data to send.
- *  \param[in] length : number of bytes to send.
+ *  \param[in] length : number of bytes of \a buffer.
+ *  \param[in] crc : CRC bytes to send after the data.
+ *  \param[in] crcLen : number of bytes of \a crc.
+ *  \param[in,out] offset : next byte to be coded.
+ *  \param[out] outbuf : coded output.
+ *  \param[in] outBufSize : size of \a outbuf.
+ *  \param[out] actOutBufSize : number of bytes written on \a outbuf.
  *
- *  \return ERR_IO : Error during communication.
- *  \return ERR_NONE : No error.
+ *  \return ERR_AGAIN : Frame not complete, to be continued.
+ *  \return ERR_NONE : Frame coded, with EOF.
  *
  *****************************************************************************
  */
-static ReturnCode iso15693PhyVCDCode1Of256(const uint8_t data, uint8_t* outbuf, uint16_t maxOutBufLen, uint16_t* outBufLen)
+static ReturnCode iso15693PhyVCDCode1Of256(const uint8_t* buffer, uint16_t length, const uint8_t* crc, uint8_t crcLen, uint16_t* offset, uint8_t* outbuf, uint16_t outBufSize, uint16_t* actOutBufSize)
 {
-    uint8_t tmp;
-    ReturnCode err = ERR_NONE;
+    static const uint8_t slot[4] = { ISO15693_DAT_SLOT0_1_256, ISO15693_DAT_SLOT1_1_256, ISO15693_DAT_SLOT2_1_256, ISO15693_DAT_SLOT3_1_256 };
+    uint16_t total;
+    uint16_t cnt;
     uint16_t a;
+    uint8_t  data;
 
-    *outBufLen = 0;
+    total = (length + crcLen);
 
-    if (maxOutBufLen < 64)
-        return ERR_NOMEM;
+    /* Bounds are checked once: the rest of the frame (plus EOF) or as many whole bytes as fit */
+    if (outBufSize >= (((uint32_t)(total - *offset) * ISO15693_DAT_LEN_1_256) + 1))
+    {
+        cnt = (total - *offset);
+    }
+    else
+    {
+        cnt = MIN((outBufSize / ISO15693_DAT_LEN_1_256), (total - *offset));
+    }
 
-    tmp = data;
-    for (a = 0; a < 64; a++)
+    /* Only one slot out of 256 is set per data byte, the byte at data/4 holds the pulse at data%4 */
+    ST_MEMSET(outbuf, 0x00, ((uint32_t)cnt * ISO15693_DAT_LEN_1_256));
+    for (a = 0; a < cnt; a++)
     {
-        switch (tmp)
-        {
-            case 0:
-                *outbuf = ISO15693_DAT_SLOT0_1_256;
-                break;
-            case 1:
-                *outbuf = ISO15693_DAT_SLOT1_1_256;
-                break;
-            case 2:
-                *outbuf = ISO15693_DAT_SLOT2_1_256;
-                break;
-            case 3:
-                *outbuf = ISO15693_DAT_SLOT3_1_256;
-                break;
-            default:
-                *outbuf = 0;
-        }
-        outbuf++;
-        (*outBufLen)++;
-        tmp -= 4;
+        data = ((*offset < length) ? buffer[*offset] : crc[*offset - length]);
+        outbuf[(a * ISO15693_DAT_LEN_1_256) + (data >> 2)] = slot[data & 0x03];
+        (*offset)++;
     }
 
-    return err;
+    outbuf         += ((uint32_t)cnt * ISO15693_DAT_LEN_1_256);
+    outBufSize     -= (cnt * ISO15693_DAT_LEN_1_256);
+    *actOutBufSize += (cnt * ISO15693_DAT_LEN_1_256);
+
+    if ((*offset < total) || (outBufSize == 0))
+    {
+        return ERR_AGAIN;
+    }
+
+    *outbuf = ISO15693_DAT_EOF_1_256;
+    (*actOutBufSize)++;
+
+    return ERR_NONE;
+}
+
+static uint16_t iso15693PhyVCDCrc(const uint8_t* buffer, uint16_t length, bool picopassMode)
+{
+    uint16_t crc;
+
+    crc = rfalCrcCalculateCcitt( ((picopassMode) ? 0xE012 : 0xFFFF),         /* In PicoPass Mode a different Preset Value is used   */
+                                 ((picopassMode) ? (buffer + 1) : buffer),   /* CMD byte is not taken into account in PicoPass mode */
+                                 ((picopassMode) ? (length - 1) : length));  /* CMD byte is not taken into account in PicoPass mode */
+
+    return ((picopassMode) ? crc : ~crc);
 }
 
 #endif /* RFAL_FEATURE_NFCV */
@@ -363,6 +363,7 @@ typedef struct{
   
   uint16_t        ourFsx;        /*!< Our current FSx FSC or FSD (Frame size)   */
   uint8_t         lastPCB;       /*!< Last PCB sent                             */
+  bool            isReTx;        /*!< Next block sent is a retransmission       */
   uint8_t         lastWTXM;      /*!< Last WTXM sent                            */
   uint8_t         atsTA;         /*!< TA on ATS                                 */
   uint8_t         hdrLen;        /*!< Current ISO-DEP length                    */
@@ -392,6 +393,15 @@ typedef struct{
   uint16_t                APDURxPos;        /*!< APDU Rx position               */
   bool                    isAPDURxChaining; /*!< APDU Transceive chaining flag  */
   
+  const rfalIsoDepListenResponse *lstRespTbl;    /*!< Listen precomputed response table     */
+  uint8_t                         lstRespTblLen; /*!< Listen response table length          */
+  uint8_t                         lstSel;        /*!< Listen response table selection state */
+  
+  rfalIsoDepStats stats;         /*!< Cumulative statistics                     */
+  uint16_t        statsTxChain;  /*!< Statistics current Tx chain depth         */
+  uint16_t        statsRxChain;  /*!< Statistics current Rx chain depth         */
+  uint32_t        statsTxTime;   /*!< Statistics system tick of last block sent */
+  
 }rfalIsoDep;
 
 
@@ -417,6 +427,11 @@ static ReturnCode isoDepHandleControlMsg( rfalIsoDepControlMsg controlMsg, uint8
 static ReturnCode isoDepReSendControlMsg( SPI* mspiChannel, ST25R3911* mST25, DigitalOut* gpio_cs, InterruptIn* IRQ, DigitalOut* fieldLED_01, DigitalOut* fieldLED_02, DigitalOut* fieldLED_03, DigitalOut* fieldLED_04, DigitalOut* fieldLED_05, DigitalOut* fieldLED_06 );
 static void rfalIsoDepCalcBitRate(rfalBitRate maxAllowedBR, uint8_t piccBRCapability, rfalBitRate *dsi, rfalBitRate *dri);
 static void rfalIsoDepApdu2IBLockParam( rfalIsoDepApduTxRxParam apduParam, rfalIsoDepTxRxParam *iBlockParam, uint16_t txPos, uint16_t rxPos );
+static bool isoDepListenFastResponse( void );
+static uint8_t isoDepLimitFSxI( uint8_t fsxi );
+static void isoDepStatsTx( uint8_t pcb, bool isReTx );
+static void isoDepStatsRx( uint8_t pcb, uint16_t infLen );
+static void isoDepStatsLatency( void );
 
 
 /*
@@ -431,6 +446,7 @@ static void isoDepClearCounters( void )
     gIsoDep.cntIRetrys   = 0;
     gIsoDep.cntRRetrys   = 0;
     gIsoDep.cntSRetrys   = 0;
+    gIsoDep.isReTx       = false;   /* Drop a retransmission flag left by a retry that hit its limit */
 }
 
 /*******************************************************************************/
@@ -438,9 +454,12 @@ static ReturnCode isoDepTx( uint8_t pcb, uint8_t* txBuf, uint8_t *infBuf, uint16
 {
     uint8_t    *txBlock;
     uint16_t   txBufLen;
+    bool       isReTx;
 
     
     txBlock         = infBuf;                      /* Point to beginning of the INF, and go backwards     */
+    isReTx          = gIsoDep.isReTx;              /* Retransmissions are flagged by the retry paths      */
+    gIsoDep.isReTx  = false;
     gIsoDep.lastPCB = pcb;                         /* Store the last PCB sent                             */
     
     
@@ -474,10 +493,152 @@ static ReturnCode isoDepTx( uint8_t pcb, uint8_t* txBuf, uint8_t *infBuf, uint16
     
     if( txBufLen > (gIsoDep.fsx - ISODEP_CRC_LEN) )/* Check if msg length violates the maximum frame size FSC */
         return ERR_NOTSUPP;
+    
+    isoDepStatsTx( pcb, isReTx );
         
     return rfalTransceiveBlockingTx( txBlock, txBufLen, gIsoDep.rxBuf, gIsoDep.rxBufLen, gIsoDep.rxLen, RFAL_TXRX_FLAGS_DEFAULT, ((gIsoDep.role == ISODEP_ROLE_PICC) ? RFAL_FWT_NONE : fwt ), mspiChannel, mST25, gpio_cs, IRQ, fieldLED_01, fieldLED_02, fieldLED_03, fieldLED_04, fieldLED_05, fieldLED_06 ) ;
 }
 
+/*******************************************************************************/
+static bool isoDepListenFastResponse( void )
+{
+    uint8_t                        i;
+    uint16_t                       infLen;
+    uint8_t                       *infBuf;
+    const rfalIsoDepListenResponse *resp;
+    
+    if( (gIsoDep.lstRespTbl == NULL) || (gIsoDep.lstRespTblLen == 0) )
+    {
+        return false;
+    }
+    
+    infBuf = (gIsoDep.rxBuf + gIsoDep.rxBufInfPos);
+    infLen = *gIsoDep.rxLen;
+    
+    for( i = 0; i < gIsoDep.lstRespTblLen; i++ )
+    {
+        resp = &gIsoDep.lstRespTbl[i];
+        
+        if( (resp->reqSel != RFAL_ISODEP_LISTEN_SEL_ANY) && (resp->reqSel != gIsoDep.lstSel) )
+        {
+            continue;
+        }
+        
+        if( (infLen >= resp->cmdLen) && !ST_BYTECMP( infBuf, resp->cmd, resp->cmdLen ) )
+        {
+            break;
+        }
+    }
+    
+    /* No match or response doesn't fit a single I-Block, hand it to the caller and drop the selection */
+    if( (i >= gIsoDep.lstRespTblLen) || (resp->resLen > rfalIsoDepGetMaxInfLen()) || (resp->resLen > (gIsoDep.rxBufLen - gIsoDep.rxBufInfPos)) )
+    {
+        gIsoDep.lstSel = RFAL_ISODEP_LISTEN_SEL_NONE;
+        return false;
+    }
+    
+    if( resp->newSel != RFAL_ISODEP_LISTEN_SEL_KEEP )
+    {
+        gIsoDep.lstSel = resp->newSel;
+    }
+    
+    /* Place the response on the rx buffer INF which is reused as tx buffer (keeps it for a retransmission) */
+    ST_MEMCPY( infBuf, resp->res, resp->resLen );
+    
+    gIsoDep.txBuf        = gIsoDep.rxBuf;
+    gIsoDep.txBufInfPos  = gIsoDep.rxBufInfPos;
+    gIsoDep.txBufLen     = resp->resLen;
+    gIsoDep.isTxChaining = false;
+    
+    return true;
+}
+
+/*******************************************************************************/
+static uint8_t isoDepLimitFSxI( uint8_t fsxi )
+{
+    /* Never announce a frame size bigger than the configured I-Block buffer */
+    while( (fsxi > RFAL_ISODEP_FSXI_16) && (rfalIsoDepFSxI2FSx( fsxi ) > RFAL_ISODEP_IBLOCK_MAX_LEN) )
+    {
+        fsxi--;
+    }
+    return fsxi;
+}
+
+/*******************************************************************************/
+static void isoDepStatsTx( uint8_t pcb, bool isReTx )
+{
+    gIsoDep.statsTxTime = platformGetSysTick();
+    
+    if( isReTx )
+    {
+        gIsoDep.stats.retransmissions++;
+        return;
+    }
+    
+    if( isoDep_PCBisIBlock(pcb) )
+    {
+        gIsoDep.stats.iBlockTx++;
+        
+        /* Chain depth is the number of I-Blocks up to the last one (no chaining bit) */
+        gIsoDep.statsTxChain++;
+        if( !isoDep_PCBisChaining(pcb) )
+        {
+            gIsoDep.stats.txChainDepthMax = MAX( gIsoDep.stats.txChainDepthMax, gIsoDep.statsTxChain );
+            gIsoDep.statsTxChain          = 0;
+        }
+    }
+    else if( isoDep_PCBisRACK(pcb) )      gIsoDep.stats.rAckTx++;
+    else if( isoDep_PCBisRNAK(pcb) )      gIsoDep.stats.rNakTx++;
+    else if( isoDep_PCBisSWTX(pcb) )      gIsoDep.stats.sWtxTx++;
+    else if( isoDep_PCBisSDeselect(pcb) ) gIsoDep.stats.deselect++;
+}
+
+/*******************************************************************************/
+static void isoDepStatsRx( uint8_t pcb, uint16_t infLen )
+{
+    uint8_t wtxm;
+    
+    if( isoDep_PCBisIBlock(pcb) )
+    {
+        gIsoDep.stats.iBlockRx++;
+        
+        gIsoDep.statsRxChain++;
+        if( !isoDep_PCBisChaining(pcb) )
+        {
+            gIsoDep.stats.rxChainDepthMax = MAX( gIsoDep.stats.rxChainDepthMax, gIsoDep.statsRxChain );
+            gIsoDep.statsRxChain          = 0;
+        }
+    }
+    else if( isoDep_PCBisRACK(pcb) )      gIsoDep.stats.rAckRx++;
+    else if( isoDep_PCBisRNAK(pcb) )      gIsoDep.stats.rNakRx++;
+    else if( isoDep_PCBisSWTX(pcb) && (infLen >= ISODEP_SWTX_INF_LEN) )
+    {
+        wtxm = isoDep_GetWTXM( gIsoDep.rxBuf[gIsoDep.hdrLen] );
+        
+        gIsoDep.stats.sWtxRx++;
+        gIsoDep.stats.wtxmSum  += wtxm;
+        gIsoDep.stats.wtxmLast  = wtxm;
+        gIsoDep.stats.wtxmMax   = MAX( gIsoDep.stats.wtxmMax, wtxm );
+    }
+}
+
+/*******************************************************************************/
+static void isoDepStatsLatency( void )
+{
+    uint32_t lat;
+    uint8_t  bin;
+    
+    lat = (platformGetSysTick() - gIsoDep.statsTxTime);
+    gIsoDep.stats.latencyMax = MAX( gIsoDep.stats.latencyMax, lat );
+    
+    /* Bin n holds [2^(n-1), 2^n[ ms, last bin holds everything above */
+    for( bin = 0; (lat > 0) && (bin < (RFAL_ISODEP_STATS_LAT_BINS - 1)); bin++ )
+    {
+        lat >>= 1;
+    }
+    gIsoDep.stats.latencyHist[bin]++;
+}
+
 /*******************************************************************************/
 static ReturnCode isoDepHandleControlMsg( rfalIsoDepControlMsg controlMsg, uint8_t param, SPI* mspiChannel, ST25R3911* mST25, DigitalOut* gpio_cs, InterruptIn* IRQ, DigitalOut* fieldLED_01, DigitalOut* fieldLED_02, DigitalOut* fieldLED_03, DigitalOut* fieldLED_04, DigitalOut* fieldLED_05, DigitalOut* fieldLED_06 )
 {
@@ -564,6 +725,8 @@ static ReturnCode isoDepHandleControlMsg( rfalIsoDepControlMsg controlMsg, uint8
 /*******************************************************************************/
 static ReturnCode isoDepReSendControlMsg(SPI* mspiChannel, ST25R3911* mST25, DigitalOut* gpio_cs, InterruptIn* IRQ, DigitalOut* fieldLED_01, DigitalOut* fieldLED_02, DigitalOut* fieldLED_03, DigitalOut* fieldLED_04, DigitalOut* fieldLED_05, DigitalOut* fieldLED_06 )
 {
+    gIsoDep.isReTx = true;
+    
     if( isoDep_PCBisRACK( gIsoDep.lastPCB ) )
     {
         return isoDepHandleControlMsg( ISODEP_R_ACK, RFAL_ISODEP_NO_PARAM, mspiChannel, mST25, gpio_cs, IRQ, fieldLED_01, fieldLED_02, fieldLED_03, fieldLED_04, fieldLED_05, fieldLED_06 ) ;
@@ -606,6 +769,7 @@ void rfalIsoDepInitialize( void )
     gIsoDep.isRxChaining = false;
     gIsoDep.lastDID00    = false;
     gIsoDep.lastPCB      = ISODEP_PCB_INVALID;
+    gIsoDep.isReTx       = false;
     gIsoDep.fsx          = RFAL_ISODEP_FSX_16;
     gIsoDep.ourFsx       = RFAL_ISODEP_FSX_16;
     gIsoDep.hdrLen       = RFAL_ISODEP_PCB_LEN;
@@ -622,6 +786,8 @@ void rfalIsoDepInitialize( void )
     gIsoDep.maxRetriesI    = RFAL_ISODEP_MAX_I_RETRYS;
     gIsoDep.maxRetriesRATS = RFAL_ISODEP_RATS_RETRIES;
     
+    gIsoDep.lstSel         = RFAL_ISODEP_LISTEN_SEL_NONE;   /* Response table itself is kept */
+    
     isoDepClearCounters();
 }
 
@@ -711,19 +877,23 @@ static ReturnCode isoDepDataExchangePCD( uint16_t *outActRxLen, bool *outIsChain
                     
                     if( gIsoDep.isRxChaining )
                     {   /* Rule 5 - In PICC chaining when a invalid/timeout occurs -> R-ACK */                        
+                        gIsoDep.isReTx = true;  /* Repeats the R(ACK) of the last chained block */
                         EXIT_ON_ERR( ret, isoDepHandleControlMsg( ISODEP_R_ACK, RFAL_ISODEP_NO_PARAM ,mspiChannel, mST25, gpio_cs, IRQ, fieldLED_01, fieldLED_02, fieldLED_03, fieldLED_04, fieldLED_05, fieldLED_06 )  );
                     }
                     else if( gIsoDep.state == ISODEP_ST_PCD_WAIT_DSL )
                     {   /* Rule 8 - If s-Deselect response fails MAY retransmit */
+                        gIsoDep.isReTx = true;
                         EXIT_ON_ERR( ret, isoDepHandleControlMsg( ISODEP_S_DSL, RFAL_ISODEP_NO_PARAM,mspiChannel, mST25, gpio_cs, IRQ, fieldLED_01, fieldLED_02, fieldLED_03, fieldLED_04, fieldLED_05, fieldLED_06 )  );
                     }
                     else
                     {   /* Rule 4 - When a invalid block or timeout occurs -> R-NACK */
+                        gIsoDep.isReTx = (gIsoDep.cntRRetrys > 0);  /* Previous R(NAK) went unanswered */
                         EXIT_ON_ERR( ret, isoDepHandleControlMsg( ISODEP_R_NAK, RFAL_ISODEP_NO_PARAM,mspiChannel, mST25, gpio_cs, IRQ, fieldLED_01, fieldLED_02, fieldLED_03, fieldLED_04, fieldLED_05, fieldLED_06 )  );
                     }
                     return ERR_BUSY;
                     
                 case ERR_NONE:
+                    isoDepStatsLatency();
                     break;
                     
                 case ERR_BUSY:
@@ -762,6 +932,8 @@ static ReturnCode isoDepDataExchangePCD( uint16_t *outActRxLen, bool *outIsChain
                 return ERR_PROTO;
             }
             
+            isoDepStatsRx( rxPCB, ((*outActRxLen) - gIsoDep.hdrLen) );
+            
             
             /*******************************************************************************/
             /* Process S-Block                                                             */
@@ -820,6 +992,7 @@ static ReturnCode isoDepDataExchangePCD( uint16_t *outActRxLen, bool *outIsChain
                         if( gIsoDep.cntIRetrys++ < gIsoDep.maxRetriesI )
                         {
                             gIsoDep.cntRRetrys = 0;            /* Clear R counter only */
+                            gIsoDep.isReTx     = true;
                             gIsoDep.state = ISODEP_ST_PCD_TX;
                             return ERR_BUSY;
                         }
@@ -961,6 +1134,47 @@ ReturnCode rfalIsoDepDeselect( SPI* mspiChannel, ST25R3911* mST25, DigitalOut* g
 }
 
 
+/*******************************************************************************/
+ReturnCode rfalIsoDepPresenceCheck( uint32_t fwt, SPI* mspiChannel, ST25R3911* mST25, DigitalOut* gpio_cs, InterruptIn* IRQ, DigitalOut* fieldLED_01, DigitalOut* fieldLED_02, DigitalOut* fieldLED_03, DigitalOut* fieldLED_04, DigitalOut* fieldLED_05, DigitalOut* fieldLED_06 )
+{
+    ReturnCode ret;
+    uint8_t    txBuf[RFAL_ISODEP_PCB_LEN + RFAL_ISODEP_DID_LEN];
+    uint8_t    rxBuf[ISODEP_CONTROLMSG_BUF_LEN];
+    uint16_t   txLen;
+    uint16_t   rxLen;
+    
+    if( (gIsoDep.role != ISODEP_ROLE_PCD) || (gIsoDep.state != ISODEP_ST_IDLE) )
+    {
+        return ERR_WRONG_STATE;
+    }
+    
+    /* After a completed exchange the PCD block number differs from the PICC one, *
+     * a R(NAK) is then answered with R(ACK) and no block is retransmitted        */
+    txLen          = 0;
+    txBuf[txLen++] = isoDep_PCBRNAK( gIsoDep.blockNumber );
+    
+    if( (gIsoDep.did != RFAL_ISODEP_NO_DID) || ((gIsoDep.did == RFAL_ISODEP_DID_00) && gIsoDep.lastDID00) )
+    {
+        txBuf[0]      |= ISODEP_PCB_DID_BIT;
+        txBuf[txLen++] = gIsoDep.did;
+    }
+    
+    /* The PICC may take the whole FWT to answer, never wait less  ISO14443-4 7.2 */
+    ret = rfalTransceiveBlockingTxRx( txBuf, txLen, rxBuf, sizeof(rxBuf), &rxLen, RFAL_TXRX_FLAGS_DEFAULT, MAX( fwt, (gIsoDep.fwt + gIsoDep.dFwt) ), mspiChannel, mST25, gpio_cs, IRQ, fieldLED_01, fieldLED_02, fieldLED_03, fieldLED_04, fieldLED_05, fieldLED_06 );
+    if( ret != ERR_NONE )
+    {
+        return ret;
+    }
+    
+    if( (rxLen < RFAL_ISODEP_PCB_LEN) || !isoDep_PCBisRACK( rxBuf[0] ) )
+    {
+        return ERR_PROTO;
+    }
+    
+    return ERR_NONE;
+}
+
+
 /*******************************************************************************/
 uint32_t rfalIsoDepFWI2FWT( uint8_t fwi )
 {
@@ -997,7 +1211,19 @@ uint16_t rfalIsoDepFSxI2FSx( uint8_t FSxI )
         case RFAL_ISODEP_FSXI_64:            return RFAL_ISODEP_FSX_64;
         case RFAL_ISODEP_FSXI_96:            return RFAL_ISODEP_FSX_96;
         case RFAL_ISODEP_FSXI_128:           return RFAL_ISODEP_FSX_128;
-    }        
+    }
+    
+    /* ISO14443-4:2016 FSxI up to 4096 bytes, RFU in EMVCo */
+    if( gIsoDep.compMode != RFAL_COMPLIANCE_MODE_EMV )
+    {
+        switch( FSxI )
+        {
+            case RFAL_ISODEP_FSXI_512:       return RFAL_ISODEP_FSX_512;
+            case RFAL_ISODEP_FSXI_1024:      return RFAL_ISODEP_FSX_1024;
+            case RFAL_ISODEP_FSXI_2048:      return RFAL_ISODEP_FSX_2048;
+            case RFAL_ISODEP_FSXI_4096:      return RFAL_ISODEP_FSX_4096;
+        }
+    }
     return RFAL_ISODEP_FSX_256;
 }
 
@@ -1063,6 +1289,7 @@ ReturnCode rfalIsoDepListenStartActivation( rfalIsoDepAtsParam *atsParam, rfalIs
     
     uint8_t *txBuf;
     uint8_t bufIt;
+    uint8_t fsci;
     
     /*******************************************************************************/
     bufIt        = 0;
@@ -1128,9 +1355,12 @@ ReturnCode rfalIsoDepListenStartActivation( rfalIsoDepAtsParam *atsParam, rfalIs
             atsParam->fwi = ISODEP_FWI_LIS_MAX;
         }
         
+        /* Enforce FSCI within the I-Block buffer, the caller's parameters are kept */
+        fsci = isoDepLimitFSxI( atsParam->fsci );
+        
         gIsoDep.atsTA  = atsParam->ta;
         gIsoDep.fwt    = rfalIsoDepFWI2FWT(atsParam->fwi);
-        gIsoDep.ourFsx = rfalIsoDepFSxI2FSx(atsParam->fsci);
+        gIsoDep.ourFsx = rfalIsoDepFSxI2FSx(fsci);
         
         
         /* Ensure proper/maximum Historical Bytes length  */
@@ -1141,7 +1371,7 @@ ReturnCode rfalIsoDepListenStartActivation( rfalIsoDepAtsParam *atsParam, rfalIs
         
         txBuf[ bufIt++ ] = (RFAL_ISODEP_ATS_HIST_OFFSET + atsParam->hbLen);                                  /* TL */
         txBuf[ bufIt++ ] = ( (RFAL_ISODEP_ATS_T0_TA_PRESENCE_MASK | RFAL_ISODEP_ATS_T0_TB_PRESENCE_MASK | 
-                              RFAL_ISODEP_ATS_T0_TC_PRESENCE_MASK)| atsParam->fsci       );                  /* T0 */
+                              RFAL_ISODEP_ATS_T0_TC_PRESENCE_MASK)| fsci                 );                  /* T0 */
         txBuf[ bufIt++ ] = atsParam->ta;                                                                     /* TA */
         txBuf[ bufIt++ ] = ( (atsParam->fwi << RFAL_ISODEP_RATS_PARAM_FSDI_SHIFT) | 
                              (atsParam->sfgi & RFAL_ISODEP_RATS_PARAM_FSDI_MASK) );                          /* TB */
@@ -1339,16 +1569,55 @@ ReturnCode rfalIsoDepListenGetActivationStatus( SPI* mspiChannel, ST25R3911* mST
 }
 
 
+/*******************************************************************************/
+ReturnCode rfalIsoDepListenSetResponseTable( const rfalIsoDepListenResponse *table, uint8_t tableLen )
+{
+    if( (table == NULL) && (tableLen != 0) )
+    {
+        return ERR_PARAM;
+    }
+    
+    gIsoDep.lstRespTbl    = table;
+    gIsoDep.lstRespTblLen = tableLen;
+    gIsoDep.lstSel        = RFAL_ISODEP_LISTEN_SEL_NONE;
+    
+    return ERR_NONE;
+}
+
+
+/*******************************************************************************/
+ReturnCode rfalIsoDepGetStats( rfalIsoDepStats *stats )
+{
+    if( stats == NULL )
+    {
+        return ERR_PARAM;
+    }
+    
+    ST_MEMCPY( stats, &gIsoDep.stats, sizeof(rfalIsoDepStats) );
+    return ERR_NONE;
+}
+
+
+/*******************************************************************************/
+void rfalIsoDepClearStats( void )
+{
+    ST_MEMSET( &gIsoDep.stats, 0x00, sizeof(rfalIsoDepStats) );
+    gIsoDep.statsTxChain = 0;
+    gIsoDep.statsRxChain = 0;
+}
+
+
 /*******************************************************************************/
 uint16_t rfalIsoDepGetMaxInfLen( void )
 {
     /* Check whether all parameters are valid, otherwise return minimum default value */
-    if( (gIsoDep.fsx < RFAL_ISODEP_FSX_16) || (gIsoDep.fsx > RFAL_ISODEP_FSX_1024) || (gIsoDep.hdrLen > ISODEP_HDR_MAX_LEN) )
+    if( (gIsoDep.fsx < RFAL_ISODEP_FSX_16) || (gIsoDep.fsx > RFAL_ISODEP_FSX_4096) || (gIsoDep.hdrLen > ISODEP_HDR_MAX_LEN) )
     {
         return (RFAL_ISODEP_FSX_16 - RFAL_ISODEP_PCB_LEN - ISODEP_CRC_LEN);
     }
     
-    return (gIsoDep.fsx - gIsoDep.hdrLen - ISODEP_CRC_LEN);
+    /* INF must also fit on the I-Block buffer */
+    return (MIN( gIsoDep.fsx, RFAL_ISODEP_IBLOCK_MAX_LEN ) - gIsoDep.hdrLen - ISODEP_CRC_LEN);
 }
 
 
@@ -1422,6 +1691,7 @@ ReturnCode isoDepDataExchangePICC( SPI* mspiChannel, ST25R3911* mST25, DigitalOu
 {
     uint8_t    rxPCB;
     ReturnCode ret;
+    bool       wasRxChaining;
     
     switch( gIsoDep.state )
     {
@@ -1560,6 +1830,8 @@ ReturnCode isoDepDataExchangePICC( SPI* mspiChannel, ST25R3911* mST25, DigitalOu
         isoDepReEnableRx( (uint8_t*)gIsoDep.actvParam.rxBuf, sizeof( rfalIsoDepBufFormat ), gIsoDep.actvParam.rxLen );
         return ERR_BUSY;  /* Ignore a unexpected NAD request */
     }
+    
+    isoDepStatsRx( rxPCB, ((*gIsoDep.rxLen) - gIsoDep.hdrLen) );
         
     /*******************************************************************************/
     /* Process S-Block                                                             */
@@ -1622,7 +1894,10 @@ ReturnCode isoDepDataExchangePICC( SPI* mspiChannel, ST25R3911* mST25, DigitalOu
                 if( !isoDep_PCBisIBlock(gIsoDep.lastPCB) )
                     isoDepReSendControlMsg( mspiChannel, mST25, gpio_cs, IRQ, fieldLED_01, fieldLED_02, fieldLED_03, fieldLED_04, fieldLED_05, fieldLED_06 ) ;
                 else
-                    gIsoDep.state = ISODEP_ST_PICC_TX;
+                {
+                    gIsoDep.isReTx = true;
+                    gIsoDep.state  = ISODEP_ST_PICC_TX;
+                }
                 
                 return ERR_BUSY;
             }
@@ -1656,7 +1931,10 @@ ReturnCode isoDepDataExchangePICC( SPI* mspiChannel, ST25R3911* mST25, DigitalOu
                 if( !isoDep_PCBisIBlock(gIsoDep.lastPCB) )
                     isoDepReSendControlMsg( mspiChannel, mST25, gpio_cs, IRQ, fieldLED_01, fieldLED_02, fieldLED_03, fieldLED_04, fieldLED_05, fieldLED_06 ) ;
                 else
-                    gIsoDep.state = ISODEP_ST_PICC_TX;
+                {
+                    gIsoDep.isReTx = true;
+                    gIsoDep.state  = ISODEP_ST_PICC_TX;
+                }
                 
                 return ERR_BUSY;
             }
@@ -1716,6 +1994,7 @@ ReturnCode isoDepDataExchangePICC( SPI* mspiChannel, ST25R3911* mST25, DigitalOu
         
         /*******************************************************************************/
         /* PCD is not performing chaining                                              */
+        wasRxChaining         = gIsoDep.isRxChaining;
         gIsoDep.isRxChaining  = false; /* clear PCD chaining flag */
         *gIsoDep.rxChaining   = false; /* Output Parameter        */
         
@@ -1727,6 +2006,16 @@ ReturnCode isoDepDataExchangePICC( SPI* mspiChannel, ST25R3911* mST25, DigitalOu
         }
         
         
+        /*******************************************************************************/
+        /* Check if the command can be answered right away from the response table     */
+        /* The block closing a chain only holds the last part of the command, skip it  */
+        if( !wasRxChaining && !gIsoDep.isWait4WTX && isoDepListenFastResponse() )
+        {
+            gIsoDep.state = ISODEP_ST_PICC_TX;
+            return isoDepDataExchangePICC( mspiChannel, mST25, gpio_cs, IRQ, fieldLED_01, fieldLED_02, fieldLED_03, fieldLED_04, fieldLED_05, fieldLED_06 ) ;
+        }
+        
+        
         /*******************************************************************************/
         /* Reception done, send data back and start WTX timer                          */
         isoDepTimerStart( gIsoDep.WTXTimer, isoDep_WTXAdjust( rfalConv1fcToMs( gIsoDep.fwt )) );
@@ -1755,6 +2044,9 @@ ReturnCode rfalIsoDepRATS( rfalIsoDepFSxI FSDI, uint8_t DID, rfalIsoDepAts *ats
         return ERR_PARAM;
     }
     
+    /* Enforce FSDI within the I-Block buffer */
+    FSDI = (rfalIsoDepFSxI)isoDepLimitFSxI( FSDI );
+    
     /*******************************************************************************/
     /* Compose RATS */
     ratsReq.CMD   = RFAL_ISODEP_CMD_RATS;
@@ -1829,6 +2121,9 @@ ReturnCode rfalIsoDepATTRIB( uint8_t* nfcid0, uint8_t PARAM1, rfalBitRate DSI, r
         return ERR_NONE;
     }
     
+    /* Enforce FSDI within the I-Block buffer */
+    FSDI = (rfalIsoDepFSxI)isoDepLimitFSxI( FSDI );
+    
     /*******************************************************************************/
     /* Compose ATTRIB command */
     attribCmd.cmd          = RFAL_ISODEP_CMD_ATTRIB;
@@ -1874,6 +2169,9 @@ ReturnCode rfalIsoDepPollAHandleActivation( rfalIsoDepFSxI FSDI, uint8_t DID, rf
         return ERR_PARAM;
     }
     
+    /* Enforce FSDI within the I-Block buffer */
+    FSDI = (rfalIsoDepFSxI)isoDepLimitFSxI( FSDI );
+    
     /* Enable EMD handling according   Digital 1.1  4.1.1.1 ; EMVCo 2.6  4.9.2 */
     rfalSetErrorHandling( RFAL_ERRORHANDLING_EMVCO );
     
@@ -2006,6 +2304,9 @@ ReturnCode rfalIsoDepPollBHandleActivation( rfalIsoDepFSxI FSDI, uint8_t DID, rf
     ReturnCode ret;
     uint8_t    mlbi;
     
+    /* Enforce FSDI within the I-Block buffer */
+    FSDI = (rfalIsoDepFSxI)isoDepLimitFSxI( FSDI );
+    
     /***************************************************************************/
     /* Initialize ISO-DEP Device with info from SENSB_RES                      */
     isoDepDev->info.FWI     = ((nfcbDev->sensbRes.protInfo.FwiAdcFo >> RFAL_NFCB_SENSB_RES_FWI_SHIFT) & RFAL_NFCB_SENSB_RES_FWI_MASK);
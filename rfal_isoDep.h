@@ -98,7 +98,8 @@
 #define RFAL_ISODEP_DEFAULT_FSC                 RFAL_ISODEP_FSX_256  /*!< FSC default value (aligned RFAL_ISODEP_DEFAULT_FSCI) */
 #define RFAL_ISODEP_DEFAULT_SFGI                (0)                  /*!< SFGI Default value to be used  in Listen Mode        */
 
-#define RFAL_ISODEP_APDU_MAX_LEN                RFAL_ISODEP_FSX_1024  /*!< Max APDU length                                     */
+#define RFAL_ISODEP_APDU_MAX_LEN                RFAL_FEATURE_ISO_DEP_APDU_MAX_LEN    /*!< Max APDU length                      */
+#define RFAL_ISODEP_IBLOCK_MAX_LEN              RFAL_FEATURE_ISO_DEP_IBLOCK_MAX_LEN  /*!< Max I-Block length (FSD/FSC)         */
 
 #define RFAL_ISODEP_ATTRIB_RES_MBLI_NO_INFO     (0x00)  /*!< MBLI indicating no information on its internal input buffer size  */
 #define RFAL_ISODEP_ATTRIB_REQ_PARAM1_DEFAULT   (0x00)  /*!< Default values of Param 1 of ATTRIB_REQ Digital 1.0  12.6.1.3-5   */
@@ -107,6 +108,12 @@
 #define RFAL_ISODEP_ATTRIB_REQ_MIN_LEN          (9)     /*!< Minimum Length of ATTRIB_REQ command                              */
 #define RFAL_ISODEP_ATTRIB_RES_MIN_LEN          (1)     /*!< Minimum Length of ATTRIB_RES response                             */
 
+#define RFAL_ISODEP_STATS_LAT_BINS              (10)    /*!< Number of block round-trip latency histogram bins (log2 of ms)     */
+
+#define RFAL_ISODEP_LISTEN_SEL_NONE             (0x00)  /*!< Listen response table: nothing selected                           */
+#define RFAL_ISODEP_LISTEN_SEL_ANY              (0xFF)  /*!< Listen response table: entry matches on any selection             */
+#define RFAL_ISODEP_LISTEN_SEL_KEEP             (0xFF)  /*!< Listen response table: entry keeps the current selection          */
+
 #define RFAL_ISODEP_ATS_TA_DPL_212              (0x01)  /*!< ATS TA DSI 212 kbps support bit mask                              */
 #define RFAL_ISODEP_ATS_TA_DPL_424              (0x02)  /*!< ATS TA DSI 424 kbps support bit mask                              */
 #define RFAL_ISODEP_ATS_TA_DPL_848              (0x04)  /*!< ATS TA DSI 848 kbps support bit mask                              */
@@ -318,7 +325,7 @@ typedef struct
 typedef struct
 {
     uint8_t  prologue[RFAL_ISODEP_PROLOGUE_SIZE];   /*!< Prologue/SoD buffer                      */
-    uint8_t  inf[RFAL_ISODEP_DEFAULT_FSC];          /*!< INF/Payload buffer                       */
+    uint8_t  inf[RFAL_ISODEP_IBLOCK_MAX_LEN];       /*!< INF/Payload buffer                       */
 } rfalIsoDepBufFormat;
 
 
@@ -330,6 +337,46 @@ typedef struct
 } rfalIsoDepApduBufFormat;
 
 
+/*! Listen mode precomputed response entry (card emulation fast path)                             */
+typedef struct
+{
+    const uint8_t *cmd;                             /*!< Command APDU prefix to be matched        */
+    uint8_t        cmdLen;                          /*!< Command APDU prefix length               */
+    const uint8_t *res;                             /*!< Precomputed response APDU (incl. SW1SW2) */
+    uint16_t       resLen;                          /*!< Precomputed response APDU length         */
+    uint8_t        reqSel;                          /*!< Selection required to match, or
+                                                         RFAL_ISODEP_LISTEN_SEL_ANY               */
+    uint8_t        newSel;                          /*!< Selection after match, or
+                                                         RFAL_ISODEP_LISTEN_SEL_KEEP              */
+} rfalIsoDepListenResponse;
+
+
+/*! ISO-DEP statistics, cumulative since last rfalIsoDepClearStats()                              */
+typedef struct
+{
+    uint32_t       iBlockTx;                        /*!< I-Blocks sent                            */
+    uint32_t       iBlockRx;                        /*!< I-Blocks received                        */
+    uint32_t       rAckTx;                          /*!< R(ACK) sent                              */
+    uint32_t       rAckRx;                          /*!< R(ACK) received                          */
+    uint32_t       rNakTx;                          /*!< R(NAK) sent                              */
+    uint32_t       rNakRx;                          /*!< R(NAK) received                          */
+    uint32_t       sWtxTx;                          /*!< S(WTX) sent                              */
+    uint32_t       sWtxRx;                          /*!< S(WTX) received                          */
+    uint32_t       wtxmSum;                         /*!< Sum of the WTXM values received          */
+    uint8_t        wtxmLast;                        /*!< Last WTXM value received                 */
+    uint8_t        wtxmMax;                         /*!< Maximum WTXM value received              */
+    uint32_t       deselect;                        /*!< S(DESELECT) sent                         */
+    uint32_t       retransmissions;                 /*!< Blocks resent by error recovery rules   */
+    uint16_t       txChainDepthMax;                 /*!< Max number of I-Blocks of a Tx chain     */
+    uint16_t       rxChainDepthMax;                 /*!< Max number of I-Blocks of a Rx chain     */
+    uint32_t       latencyMax;                      /*!< Max block round-trip latency (ms)        */
+    uint32_t       latencyHist[RFAL_ISODEP_STATS_LAT_BINS]; /*!< Block round-trip latency
+                                                         histogram, bin n counts latencies within
+                                                         [2^(n-1), 2^n[ ms, bin 0 below 1ms and
+                                                         last bin everything above               */
+} rfalIsoDepStats;
+
+
 /*! Listen Activation Parameters Structure */
 typedef struct
 {
@@ -422,6 +469,9 @@ void rfalIsoDepInitializeWithParams( rfalComplianceMode compMode, uint8_t maxRet
  *
  *  The FSD/FSC value includes the header and CRC
  *
+ *  FSxI values 9 to 12 (512 to 4096 bytes, ISO14443-4:2016) are RFU in
+ *  EMVCo and are then treated as 256 bytes, as any other RFU value
+ *
  *  \param[in] fsxi :  Frame Size for proximity coupling Device Integer
  *
  *  \return fsx : Frame Size for proximity coupling Device (FSD or FSC)
@@ -532,12 +582,83 @@ ReturnCode rfalIsoDepListenStartActivation( rfalIsoDepAtsParam *atsParam, rfalIs
 ReturnCode rfalIsoDepListenGetActivationStatus( SPI* mspiChannel, ST25R3911* mST25, DigitalOut* gpio_cs, InterruptIn* IRQ, DigitalOut* fieldLED_01, DigitalOut* fieldLED_02, DigitalOut* fieldLED_03, DigitalOut* fieldLED_04, DigitalOut* fieldLED_05, DigitalOut* fieldLED_06 );
 
 
+/*!
+ *****************************************************************************
+ *  \brief Set the Listen mode response table
+ *
+ *  Registers a table of precomputed responses used by the ISO-DEP layer while
+ *  in Listen mode (card emulation). Whenever a complete (not chained) I-Block
+ *  is received whose INF starts with the cmd prefix of an entry, the response
+ *  of that entry is sent back directly by rfalIsoDepGetTransceiveStatus()
+ *  without handing the I-Block to the caller. This allows static commands such
+ *  as SELECT AID, SELECT of the CC/NDEF files and READ BINARY of static files
+ *  to be answered without any application turnaround.
+ *
+ *  A simple selection state is kept to allow file dependent responses: an
+ *  entry only matches if its reqSel equals the current selection (or is
+ *  RFAL_ISODEP_LISTEN_SEL_ANY), and once matched the current selection is set
+ *  to its newSel (unless RFAL_ISODEP_LISTEN_SEL_KEEP).
+ *  Any I-Block that is not answered from the table is passed to the caller as
+ *  usual and resets the selection to RFAL_ISODEP_LISTEN_SEL_NONE, so that a
+ *  command handled by the caller never leaves a stale file selected.
+ *
+ *  Entries are evaluated in order, the first match is used.
+ *  The response must fit into a single I-Block (no chaining) and into the
+ *  I-Block buffer provided on rfalIsoDepStartTransceive(), otherwise the
+ *  command is passed to the caller.
+ *
+ *  The table is kept across rfalIsoDepInitialize(), the selection is reset.
+ *  The table and the referenced data must remain valid while in use.
+ *
+ *  \param[in] table    : reference to the response table, NULL to disable
+ *  \param[in] tableLen : number of entries in the table
+ *
+ *  \return ERR_PARAM : Invalid parameters
+ *  \return ERR_NONE  : No error
+ *****************************************************************************
+ */
+ReturnCode rfalIsoDepListenSetResponseTable( const rfalIsoDepListenResponse *table, uint8_t tableLen );
+
+
+/*!
+ *****************************************************************************
+ *  \brief Get the ISO-DEP statistics
+ *
+ *  Copies the ISO-DEP statistics accumulated since the last call to
+ *  rfalIsoDepClearStats(). Counters are kept across rfalIsoDepInitialize()
+ *  and therefore cover all ISO-DEP sessions since they were cleared.
+ *
+ *  The block round-trip latency is measured as Poller (PCD) only, from the
+ *  transmission of a block until the reception of its response, with the
+ *  platform system tick resolution.
+ *
+ *  \param[out] stats : location where the statistics shall be copied
+ *
+ *  \return ERR_PARAM : Invalid parameters
+ *  \return ERR_NONE  : No error
+ *****************************************************************************
+ */
+ReturnCode rfalIsoDepGetStats( rfalIsoDepStats *stats );
+
+
+/*!
+ *****************************************************************************
+ *  \brief Clear the ISO-DEP statistics
+ *
+ *  Resets all ISO-DEP statistics counters and the latency histogram
+ *****************************************************************************
+ */
+void rfalIsoDepClearStats( void );
+
+
 /*!
  *****************************************************************************
  *  \brief Get the ISO-DEP Communication Information
  *
  *  Gets the maximum INF length in bytes based on current Frame Size
  *  for proximity coupling Device (FSD or FSC) excluding the header and CRC
+ *  The Frame Size is limited to the configured I-Block buffer length
+ *  RFAL_FEATURE_ISO_DEP_IBLOCK_MAX_LEN
  *
  *  \return maximum INF length in bytes
  *****************************************************************************
@@ -742,6 +863,27 @@ ReturnCode rfalIsoDepATTRIB( uint8_t* nfcid0, uint8_t PARAM1, rfalBitRate DSI, r
  */
 ReturnCode rfalIsoDepDeselect( SPI* mspiChannel, ST25R3911* mST25, DigitalOut* gpio_cs, InterruptIn* IRQ, DigitalOut* fieldLED_01, DigitalOut* fieldLED_02, DigitalOut* fieldLED_03, DigitalOut* fieldLED_04, DigitalOut* fieldLED_05, DigitalOut* fieldLED_06 );
 
+
+/*!
+ *****************************************************************************
+ *  \brief  Checks presence of the activated PICC
+ *
+ *  Sends a R(NAK) with the current block number and waits for the PICC's
+ *  R(ACK)  ISO14443-4 7.5.4.2 rule 12. The PICC protocol state is not
+ *  changed so it may be used in between I-Block exchanges, while no 
+ *  transceive is ongoing
+ *
+ *  \param[in]  fwt : Time to wait for the R(ACK) (1/fc), 0 or any value
+ *                    below the activation FWT + dFWT uses the latter
+ *
+ *  \return ERR_WRONG_STATE : Not in Poller role or a transceive is ongoing
+ *  \return ERR_TIMEOUT     : No response rcvd from PICC
+ *  \return ERR_PROTO       : Response rcvd is not a R(ACK)
+ *  \return ERR_NONE        : R(ACK) rcvd, PICC is present
+ *****************************************************************************
+ */
+ReturnCode rfalIsoDepPresenceCheck( uint32_t fwt, SPI* mspiChannel, ST25R3911* mST25, DigitalOut* gpio_cs, InterruptIn* IRQ, DigitalOut* fieldLED_01, DigitalOut* fieldLED_02, DigitalOut* fieldLED_03, DigitalOut* fieldLED_04, DigitalOut* fieldLED_05, DigitalOut* fieldLED_06 );
+
 /*!
  *****************************************************************************
  *  \brief  ISO-DEP Poller Handle NFC-A Activation
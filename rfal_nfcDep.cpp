@@ -212,6 +212,11 @@
 #define nfcipIsDeactivationPending()   ( (gNfcip.isDeactivating == NULL) ? false : gNfcip.isDeactivating() )
 
 
+#define nfcipTxBufHdr()                ( (gNfcip.txSegCnt > 0) ? gNfcip.txHdr : gNfcip.txBuf )                                             /*!< Buffer where the I-PDU header is to be placed  */
+#define nfcipTxBufPayl()               ( (gNfcip.txSegCnt > 0) ? &gNfcip.txHdr[RFAL_NFCDEP_DEPREQ_HEADER_LEN] : (gNfcip.txBuf + gNfcip.txBufPaylPos) ) /*!< Location of the I-PDU payload, end of prefix if segmented */
+
+#define nfcipPduMaxInfLen( fsc )       ( MIN( (fsc), RFAL_NFCDEP_FRAME_SIZE_MAX_LEN ) - RFAL_NFCDEP_DEPREQ_HEADER_LEN - RFAL_NFCDEP_LEN_LEN ) /*!< Data per DEP block on a PDU Transceive */
+
 #define nfcipRTOXAdjust( v )           (v - (v>>3))                                                   /*!< Adjust RTOX timer value to a percentage of the total, current 88% */ 
 
 /*******************************************************************************/
@@ -346,6 +351,19 @@ typedef struct{
   bool                    isReqPending;      /*!< Flag pending REQ from Target activation       */
   bool                    isTxPending;       /*!< Flag pending DEP Block while waiting RTOX Ack */
   bool                    isWait4RTOX;       /*!< Flag for waiting RTOX Ack                     */
+  
+  uint8_t                 txHdr[RFAL_NFCDEP_DEPREQ_HEADER_LEN];  /*!< Prefix buffer for the header of a segmented I-PDU */
+  rfalTransceiveSegment   txSeg[RFAL_NFCDEP_TX_SEG_MAX + 1];     /*!< Segments to be sent: prefix + outgoing data     */
+  uint8_t                 txSegCnt;          /*!< Number of outgoing data segments, 0 if txBuf is used  */
+  
+  rfalNfcDepPduTxRxParam  PDUParam;          /*!< PDU TxRx params                               */
+  uint32_t                PDUTxPos;          /*!< PDU Tx position                               */
+  uint32_t                PDURxPos;          /*!< PDU Rx position                               */
+  uint16_t                PDUTxBlkLen;       /*!< Length of the current Tx DEP block            */
+  uint16_t                PDURxBlkLen;       /*!< Length of the current Rx DEP block            */
+  bool                    isPDURxChaining;   /*!< PDU Transceive chaining flag                  */
+  uint32_t                PDUStartTick;      /*!< System tick when the PDU Transceive started   */
+  uint32_t                PDUThroughput;     /*!< Last PDU Transceive throughput in bytes/s     */
 }rfalNfcDep;
 
 
@@ -454,6 +472,37 @@ static ReturnCode nfcipRun( uint16_t *outActRxLen, bool *outIsChaining, SPI* msp
 static ReturnCode nfcipDataTx( uint8_t* txBuf, uint16_t txBufLen, uint32_t fwt, SPI* mspiChannel, ST25R3911* mST25, DigitalOut* gpio_cs, InterruptIn* IRQ, DigitalOut* fieldLED_01, DigitalOut* fieldLED_02, DigitalOut* fieldLED_03, DigitalOut* fieldLED_04, DigitalOut* fieldLED_05, DigitalOut* fieldLED_06 );
 
 
+/*!
+ ******************************************************************************
+ * \brief NFCIP Data Transmission from segments
+ *
+ * Sends the header placed on the prefix buffer followed by the outgoing data
+ * segments, streaming them into the FIFO
+ *
+ * \param[in]   hdr    : location of the header inside the prefix buffer
+ * \param[in]   hdrLen : length of the header
+ * \param[in]   fwt    : fwt for current Tx
+ *
+ * \return ERR_NONE       : No error
+ ******************************************************************************
+ */
+static ReturnCode nfcipDataTxSegments( uint8_t* hdr, uint8_t hdrLen, uint32_t fwt, SPI* mspiChannel, ST25R3911* mST25, DigitalOut* gpio_cs, InterruptIn* IRQ, DigitalOut* fieldLED_01, DigitalOut* fieldLED_02, DigitalOut* fieldLED_03, DigitalOut* fieldLED_04, DigitalOut* fieldLED_05, DigitalOut* fieldLED_06 );
+
+
+/*!
+ ******************************************************************************
+ * \brief PDU Transceive start block
+ *
+ * Starts the Transceive of the next DEP block of the current PDU, the block
+ * data is streamed directly from the PDU buffer
+ *
+ * \return ERR_NONE       : No error
+ * \return ERR_PARAM      : Invalid parameters
+ ******************************************************************************
+ */
+static ReturnCode nfcipPduStartBlock( void );
+
+
 /*!
  ******************************************************************************
  * \brief Reception method
@@ -1499,6 +1548,13 @@ static ReturnCode nfcipTx( rfalNfcDepCmd cmd, uint8_t* txBuf, uint8_t *paylBuf,
     {
         return ERR_NOTSUPP;
     }
+    
+    /*******************************************************************************/
+    /* Segmented I-PDU: header is on the prefix buffer, payload on the segments    */
+    if( (gNfcip.txSegCnt > 0) && (paylBuf == &gNfcip.txHdr[RFAL_NFCDEP_DEPREQ_HEADER_LEN]) )
+    {
+        return nfcipDataTxSegments( txBlock, (uint8_t)(paylBuf - txBlock), fwt, mspiChannel, mST25, gpio_cs, IRQ, fieldLED_01, fieldLED_02, fieldLED_03, fieldLED_04, fieldLED_05, fieldLED_06 );
+    }
         
     /*******************************************************************************/
     return nfcipDataTx( txBlock, txBufIt, fwt, mspiChannel, mST25, gpio_cs, IRQ, fieldLED_01, fieldLED_02, fieldLED_03, fieldLED_04, fieldLED_05, fieldLED_06 ) ;
@@ -1545,7 +1601,7 @@ static ReturnCode nfcipRun( uint16_t *outActRxLen, bool *outIsChaining, SPI* msp
         case NFCIP_ST_INIT_DEP_TX:
             
             nfcipLogD( " NFCIP(I) Tx PNI: %d txLen: %d \r\n", gNfcip.pni, gNfcip.txBufLen );
-            ret = nfcipTx( NFCIP_CMD_DEP_REQ, gNfcip.txBuf, (gNfcip.txBuf + gNfcip.txBufPaylPos), gNfcip.txBufLen, nfcip_PFBIPDU( gNfcip.pni ), (gNfcip.cfg.fwt + gNfcip.cfg.dFwt), mspiChannel, mST25, gpio_cs, IRQ, fieldLED_01, fieldLED_02, fieldLED_03, fieldLED_04, fieldLED_05, fieldLED_06 ) ;
+            ret = nfcipTx( NFCIP_CMD_DEP_REQ, nfcipTxBufHdr(), nfcipTxBufPayl(), gNfcip.txBufLen, nfcip_PFBIPDU( gNfcip.pni ), (gNfcip.cfg.fwt + gNfcip.cfg.dFwt), mspiChannel, mST25, gpio_cs, IRQ, fieldLED_01, fieldLED_02, fieldLED_03, fieldLED_04, fieldLED_05, fieldLED_06 ) ;
                         
             switch( ERR_NO_MASK(ret) )
             {
@@ -1610,7 +1666,7 @@ static ReturnCode nfcipRun( uint16_t *outActRxLen, bool *outIsChaining, SPI* msp
         case NFCIP_ST_TARG_DEP_TX:
             
             nfcipLogD( " NFCIP(T) Tx PNI: %d txLen: %d \r\n", gNfcip.pni, gNfcip.txBufLen );
-            ret = nfcipTx( NFCIP_CMD_DEP_RES, gNfcip.txBuf, (gNfcip.txBuf + gNfcip.txBufPaylPos), gNfcip.txBufLen, nfcip_PFBIPDU( gNfcip.pni ), NFCIP_NO_FWT, mspiChannel, mST25, gpio_cs, IRQ, fieldLED_01, fieldLED_02, fieldLED_03, fieldLED_04, fieldLED_05, fieldLED_06 ) ;
+            ret = nfcipTx( NFCIP_CMD_DEP_RES, nfcipTxBufHdr(), nfcipTxBufPayl(), gNfcip.txBufLen, nfcip_PFBIPDU( gNfcip.pni ), NFCIP_NO_FWT, mspiChannel, mST25, gpio_cs, IRQ, fieldLED_01, fieldLED_02, fieldLED_03, fieldLED_04, fieldLED_05, fieldLED_06 ) ;
             
             /* Clear flags */
             gNfcip.isTxPending = false;
@@ -1680,6 +1736,8 @@ void rfalNfcDepInitialize( void )
     gNfcip.isWait4RTOX    = false;
     gNfcip.isReqPending   = false;
     
+    gNfcip.txSegCnt       = 0;
+    gNfcip.PDUThroughput  = 0;
             
     gNfcip.cfg.oper  = (RFAL_NFCDEP_OPER_FULL_MI_DIS | RFAL_NFCDEP_OPER_EMPTY_DEP_EN | RFAL_NFCDEP_OPER_ATN_EN | RFAL_NFCDEP_OPER_RTOX_REQ_EN);
     
@@ -1716,6 +1774,7 @@ static void nfcipSetDEPParams( rfalNfcDepDEPParams *DEPParams )
     gNfcip.rxBufLen     = DEPParams->rxBufLen;
     gNfcip.txBufPaylPos = DEPParams->txBufPaylPos;
     gNfcip.rxBufPaylPos = DEPParams->rxBufPaylPos;
+    gNfcip.txSegCnt     = 0;
     
     if( DEPParams->did != RFAL_NFCDEP_DID_KEEP )
     {
@@ -2293,6 +2352,17 @@ static ReturnCode nfcipDataTx( uint8_t* txBuf, uint16_t txBufLen, uint32_t fwt,
 }
 
 
+/*******************************************************************************/
+static ReturnCode nfcipDataTxSegments( uint8_t* hdr, uint8_t hdrLen, uint32_t fwt, SPI* mspiChannel, ST25R3911* mST25, DigitalOut* gpio_cs, InterruptIn* IRQ, DigitalOut* fieldLED_01, DigitalOut* fieldLED_02, DigitalOut* fieldLED_03, DigitalOut* fieldLED_04, DigitalOut* fieldLED_05, DigitalOut* fieldLED_06 )
+{
+    /* First segment is always the header on the prefix buffer */
+    gNfcip.txSeg[0].buf = hdr;
+    gNfcip.txSeg[0].len = hdrLen;
+    
+    return rfalTransceiveBlockingTxSegments( gNfcip.txSeg, (gNfcip.txSegCnt + 1), gNfcip.rxBuf, gNfcip.rxBufLen, gNfcip.rxRcvdLen, (RFAL_TXRX_FLAGS_DEFAULT | RFAL_TXRX_FLAGS_NFCIP1_ON), ((fwt == NFCIP_NO_FWT) ? RFAL_FWT_NONE : rfalConv64fcTo1fc(fwt)), mspiChannel, mST25, gpio_cs, IRQ, fieldLED_01, fieldLED_02, fieldLED_03, fieldLED_04, fieldLED_05, fieldLED_06 );
+}
+
+
 /*******************************************************************************/
 static ReturnCode nfcipDataRx( void )
 {
@@ -2479,6 +2549,165 @@ ReturnCode rfalNfcDepStartTransceive( rfalNfcDepTxRxParam *param )
 }
 
 
+/*******************************************************************************/
+ReturnCode rfalNfcDepStartTransceiveSegments( rfalNfcDepTxRxParam *param, const rfalTransceiveSegment *txSeg, uint8_t txSegCnt )
+{
+    uint32_t totalLen;
+    uint8_t  i;
+    
+    if( (param == NULL) || (txSeg == NULL) || (txSegCnt == 0) || (txSegCnt > RFAL_NFCDEP_TX_SEG_MAX) )
+    {
+        return ERR_PARAM;
+    }
+    
+    totalLen = 0;
+    for( i = 0; i < txSegCnt; i++ )
+    {
+        if( (txSeg[i].buf == NULL) && (txSeg[i].len > 0) )
+        {
+            return ERR_PARAM;
+        }
+        totalLen += txSeg[i].len;
+    }
+    
+    /* The whole I-PDU must still fit in a single frame, FSC is checked upon Tx */
+    if( totalLen > RFAL_NFCDEP_FRAME_SIZE_MAX_LEN )
+    {
+        return ERR_PARAM;
+    }
+    
+    rfalNfcDepStartTransceive( param );
+    
+    /* Keep the segments after the header prefix slot, they are reused on retransmissions */
+    ST_MEMCPY( &gNfcip.txSeg[1], txSeg, (txSegCnt * sizeof(rfalTransceiveSegment)) );
+    gNfcip.txSegCnt = txSegCnt;
+    gNfcip.txBuf    = NULL;
+    gNfcip.txBufLen = (uint16_t)totalLen;
+    
+    return ERR_NONE;
+}
+
+
+/*******************************************************************************/
+static ReturnCode nfcipPduStartBlock( void )
+{
+    rfalNfcDepTxRxParam   txRxParam;
+    rfalTransceiveSegment txSeg;
+    uint32_t              remLen;
+    uint16_t              maxInf;
+    
+    maxInf = nfcipPduMaxInfLen( gNfcip.PDUParam.FSx );
+    remLen = (gNfcip.PDUParam.txBufLen - gNfcip.PDUTxPos);
+    
+    /* Chain while the remaining PDU does not fit on a single block */
+    txRxParam.isTxChaining = (remLen > maxInf);
+    gNfcip.PDUTxBlkLen     = (uint16_t)MIN( remLen, maxInf );
+    
+    txRxParam.txBuf        = NULL;
+    txRxParam.txBufLen     = gNfcip.PDUTxBlkLen;
+    txRxParam.rxBuf        = gNfcip.PDUParam.tmpBuf;
+    txRxParam.rxLen        = &gNfcip.PDURxBlkLen;
+    txRxParam.isRxChaining = &gNfcip.isPDURxChaining;
+    txRxParam.FWT          = gNfcip.PDUParam.FWT;
+    txRxParam.dFWT         = gNfcip.PDUParam.dFWT;
+    txRxParam.FSx          = gNfcip.PDUParam.FSx;
+    txRxParam.DID          = gNfcip.PDUParam.DID;
+    
+    txSeg.buf = ((gNfcip.PDUParam.txBuf != NULL) ? &gNfcip.PDUParam.txBuf[gNfcip.PDUTxPos] : NULL);
+    txSeg.len = gNfcip.PDUTxBlkLen;
+    
+    return rfalNfcDepStartTransceiveSegments( &txRxParam, &txSeg, 1 );
+}
+
+
+/*******************************************************************************/
+ReturnCode rfalNfcDepStartPduTransceive( rfalNfcDepPduTxRxParam param )
+{
+    if( (param.tmpBuf == NULL) || (param.rxCb == NULL) || ((param.txBuf == NULL) && (param.txBufLen > 0)) )
+    {
+        return ERR_PARAM;
+    }
+    
+    /* Ensure that at least one data byte fits on each block */
+    if( param.FSx <= (RFAL_NFCDEP_DEPREQ_HEADER_LEN + RFAL_NFCDEP_LEN_LEN) )
+    {
+        return ERR_PARAM;
+    }
+    
+    /* Initialize and store PDU context */
+    gNfcip.PDUParam      = param;
+    gNfcip.PDUTxPos      = 0;
+    gNfcip.PDURxPos      = 0;
+    gNfcip.PDUStartTick  = platformGetSysTick();
+    gNfcip.PDUThroughput = 0;
+    
+    return nfcipPduStartBlock();
+}
+
+
+/*******************************************************************************/
+ReturnCode rfalNfcDepGetPduTransceiveStatus( SPI* mspiChannel, ST25R3911* mST25, DigitalOut* gpio_cs, InterruptIn* IRQ, DigitalOut* fieldLED_01, DigitalOut* fieldLED_02, DigitalOut* fieldLED_03, DigitalOut* fieldLED_04, DigitalOut* fieldLED_05, DigitalOut* fieldLED_06 )
+{
+    ReturnCode ret;
+    uint32_t   elapsed;
+    
+    ret = rfalNfcDepGetTransceiveStatus( mspiChannel, mST25, gpio_cs, IRQ, fieldLED_01, fieldLED_02, fieldLED_03, fieldLED_04, fieldLED_05, fieldLED_06 );
+    switch( ret )
+    {
+        /*******************************************************************************/
+        case ERR_NONE:
+            
+            /* Current block has been acknowledged */
+            gNfcip.PDUTxPos += gNfcip.PDUTxBlkLen;
+            if( gNfcip.PDUParam.txCb != NULL )
+            {
+                gNfcip.PDUParam.txCb( gNfcip.PDUTxPos, gNfcip.PDUParam.txBufLen );
+            }
+            
+            /* Check if we are still doing chaining on Tx */
+            if( gNfcip.isTxChaining )
+            {
+                EXIT_ON_ERR( ret, nfcipPduStartBlock() );
+                return ERR_BUSY;
+            }
+            
+            /* Deliver last block of the response */
+            EXIT_ON_ERR( ret, gNfcip.PDUParam.rxCb( gNfcip.PDUParam.tmpBuf->inf, gNfcip.PDURxBlkLen, true ) );
+            gNfcip.PDURxPos += gNfcip.PDURxBlkLen;
+            
+            /* PDU TxRx is done */
+            break;
+            
+        /*******************************************************************************/
+        case ERR_AGAIN:
+            
+            /* Deliver chained block, the next one is already being received */
+            EXIT_ON_ERR( ret, gNfcip.PDUParam.rxCb( gNfcip.PDUParam.tmpBuf->inf, gNfcip.PDURxBlkLen, false ) );
+            gNfcip.PDURxPos += gNfcip.PDURxBlkLen;
+            
+            /* Wait for next DEP block */
+            return ERR_BUSY;
+            
+        /*******************************************************************************/
+        default:
+            return ret;
+    }
+    
+    /* Calculate the throughput over the whole PDU exchange */
+    elapsed = MAX( (platformGetSysTick() - gNfcip.PDUStartTick), 1 );
+    gNfcip.PDUThroughput = (uint32_t)( ((uint64_t)(gNfcip.PDUTxPos + gNfcip.PDURxPos) * 1000) / elapsed );
+    
+    return ERR_NONE;
+}
+
+
+/*******************************************************************************/
+uint32_t rfalNfcDepGetPduThroughput( void )
+{
+    return gNfcip.PDUThroughput;
+}
+
+
 /*******************************************************************************/
 ReturnCode rfalNfcDepGetTransceiveStatus( SPI* mspiChannel, ST25R3911* mST25, DigitalOut* gpio_cs, InterruptIn* IRQ, DigitalOut* fieldLED_01, DigitalOut* fieldLED_02, DigitalOut* fieldLED_03, DigitalOut* fieldLED_04, DigitalOut* fieldLED_05, DigitalOut* fieldLED_06 )
 {
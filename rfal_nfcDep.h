@@ -73,6 +73,7 @@
  */
 #define RFAL_NFCDEP_FRAME_SIZE_MAX_LEN  254             /*!< NFCIP Maximum Frame Size   Digital 1.0 Table 91                 */
 #define RFAL_NFCDEP_DEPREQ_HEADER_LEN   5               /*!< DEP_REQ header length: CMD_TYPE + CMD_CMD + PBF + DID + NAD     */
+#define RFAL_NFCDEP_TX_SEG_MAX          8               /*!< Maximum number of segments on a scatter-gather Transceive       */
 
 
 
@@ -224,6 +225,13 @@ enum{
 /*! NFC-DEP callback to check if upper layer has deactivation pending   */
 typedef bool (* rfalNfcDepDeactCallback)(void);
 
+/*! NFC-DEP PDU callback delivering received data as each DEP block arrives (isLast set on the final block).
+ *  Returning other than ERR_NONE aborts the PDU Transceive with the returned error                        */
+typedef ReturnCode (* rfalNfcDepPduRxCallback)( const uint8_t *data, uint16_t dataLen, bool isLast );
+
+/*! NFC-DEP PDU callback signalling the amount of PDU data already acknowledged by the other device        */
+typedef void (* rfalNfcDepPduTxCallback)( uint32_t sentLen, uint32_t totalLen );
+
 
 /*! Enumeration of the nfcip communication modes */
 typedef enum{
@@ -409,6 +417,21 @@ typedef struct
 } rfalNfcDepTxRxParam;
 
 
+/*! Structure of parameters to be passed in for rfalNfcDepStartPduTransceive */
+typedef struct
+{
+    const uint8_t           *txBuf;     /*!< PDU to be sent, no prologue space needed  */
+    uint32_t                txBufLen;   /*!< PDU length in bytes (may span many blocks)*/
+    rfalNfcDepBufFormat     *tmpBuf;    /*!< Temp buffer for Rx DEP blocks (internal)  */
+    rfalNfcDepPduRxCallback rxCb;       /*!< Callback to deliver the received data     */
+    rfalNfcDepPduTxCallback txCb;       /*!< Tx progress callback (optional)           */
+    uint32_t                FWT;        /*!< FWT to be used (ignored in Listen Mode)   */
+    uint32_t                dFWT;       /*!< Delta FWT to be used                      */
+    uint16_t                FSx;        /*!< Other device Frame Size (FSD or FSC)      */
+    uint8_t                 DID;        /*!< Device ID (RFAL_ISODEP_NO_DID if no DID)  */
+} rfalNfcDepPduTxRxParam;
+
+
 /*
  * *****************************************************************************
  * GLOBAL VARIABLE DECLARATIONS
@@ -663,6 +686,30 @@ ReturnCode rfalNfcDepListenGetActivationStatus( SPI*  mspiChannel, ST25R3911* mS
  */
 ReturnCode rfalNfcDepStartTransceive( rfalNfcDepTxRxParam *param );
 
+/*!
+ *****************************************************************************
+ * \brief Start Transceive from segments
+ *
+ * Same as rfalNfcDepStartTransceive() but the outgoing data is given as a 
+ * list of segments instead of param's txBuf, which is ignored.
+ *
+ * The I-PDU header is built on an internal prefix buffer and the segments 
+ * are streamed into the FIFO as they are, no prologue space is required
+ * in front of the data nor a contiguous copy of it.
+ *
+ * The segments list and the data it points to must remain valid until the
+ * Transceive has been completed (retransmissions reuse them)
+ *
+ * \param[in] param    : reference parameters to be used for the Transceive
+ * \param[in] txSeg    : list of segments forming the outgoing data
+ * \param[in] txSegCnt : number of segments on txSeg [1, RFAL_NFCDEP_TX_SEG_MAX]
+ *
+ * \return ERR_PARAM       : Bad request
+ * \return ERR_NONE        : The Transceive request has been started
+ *****************************************************************************
+ */
+ReturnCode rfalNfcDepStartTransceiveSegments( rfalNfcDepTxRxParam *param, const rfalTransceiveSegment *txSeg, uint8_t txSegCnt );
+
 
 /*!
  *****************************************************************************
@@ -694,6 +741,63 @@ ReturnCode rfalNfcDepStartTransceive( rfalNfcDepTxRxParam *param );
 ReturnCode rfalNfcDepGetTransceiveStatus( SPI* mspiChannel, ST25R3911* mST25, DigitalOut* gpio_cs, InterruptIn* IRQ, DigitalOut* fieldLED_01, DigitalOut* fieldLED_02, DigitalOut* fieldLED_03, DigitalOut* fieldLED_04, DigitalOut* fieldLED_05, DigitalOut* fieldLED_06 );
 
 
+/*!
+ *****************************************************************************
+ * \brief Start PDU Transceive
+ *
+ * Transceives a complete PDU of arbitrary length. The PDU is split in DEP 
+ * blocks according to FSx and sent with MI chaining, the data of each block
+ * is streamed from txBuf without being copied.
+ * The response is delivered through rxCb as each block arrives, therefore
+ * its total length is not bound to any buffer.
+ *
+ * ACK/NACK, ATN and RTOX are handled internally by the DEP layer
+ *
+ * \warning txBuf must remain valid until the PDU Transceive has completed
+ *
+ * \param[in] param: reference parameters to be used for the PDU Transceive
+ *
+ * \return ERR_PARAM       : Bad request
+ * \return ERR_NONE        : The PDU Transceive request has been started
+ *****************************************************************************
+ */
+ReturnCode rfalNfcDepStartPduTransceive( rfalNfcDepPduTxRxParam param );
+
+
+/*!
+ *****************************************************************************
+ * \brief Return the PDU Transceive status
+ *
+ * Runs the PDU Transceive, starting the following blocks of the outgoing 
+ * PDU and delivering the incoming blocks to the Rx callback
+ *
+ * \return ERR_NONE      : PDU Transceive has been completed successfully
+ * \return ERR_BUSY      : PDU Transceive is ongoing
+ * \return ERR_PROTO     : Protocol error occurred
+ * \return ERR_TIMEOUT   : Timeout error occurred
+ * \return ERR_SLEEP_REQ : Deselect has been received and responded
+ * \return ERR_NOMEM     : The received I-PDU does not fit into tmpBuf
+ * \return ERR_LINK_LOSS : Communication is lost because Reader/Writer
+ *                            has turned off its field
+ * \return ERR_XXXX      : Error returned by the Rx callback
+ *****************************************************************************
+ */
+ReturnCode rfalNfcDepGetPduTransceiveStatus( SPI* mspiChannel, ST25R3911* mST25, DigitalOut* gpio_cs, InterruptIn* IRQ, DigitalOut* fieldLED_01, DigitalOut* fieldLED_02, DigitalOut* fieldLED_03, DigitalOut* fieldLED_04, DigitalOut* fieldLED_05, DigitalOut* fieldLED_06 );
+
+
+/*!
+ *****************************************************************************
+ * \brief Get the last PDU Transceive throughput
+ *
+ * Returns the throughput of the last completed PDU Transceive, accounting
+ * the PDU data sent and received from its start until its completion
+ *
+ * \return Throughput in bytes per second, 0 if not available
+ *****************************************************************************
+ */
+uint32_t rfalNfcDepGetPduThroughput( void );
+
+
 #endif /* RFAL_NFCDEP_H_ */
 
 /**
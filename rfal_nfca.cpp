@@ -47,6 +47,7 @@
  */
 #include <platform1.h>
 #include "rfal_nfca.h"
+#include "rfal_isoDep.h"
 #include "utils.h"
 
 /*
@@ -88,6 +89,10 @@
 
 #define RFAL_NFCA_T_RETRANS         5                   /*!< t RETRANSMISSION [3, 33]ms   EMVCo 2.6  A.5      */
 #define RFAL_NFCA_N_RETRANS         2                   /*!< Number of retries            EMVCo 2.6  9.6.1.3  */
+
+#define RFAL_NFCA_COLL_TREE_LEN     16                  /*!< Max number of unexplored UID branches kept between anticollision passes */
+
+#define RFAL_NFCA_PRESENCE_MISS_MAX 2                   /*!< Consecutive missed probes for a device to be declared removed            */
  
 
 /*! SDD_REQ (Select) Cascade Levels  */
@@ -130,12 +135,40 @@ typedef struct
     uint8_t      frame[RFAL_NFCA_SLP_REQ_LEN];  /*!< SLP:  0x50 0x00  */
 } rfalNfcaSlpReq;
 
+
+/*! Branch point of the UID prefix tree left unexplored by an anticollision pass                                */
+typedef struct
+{
+    uint8_t      cl;                                                          /*!< Cascade Level of the branch point            */
+    uint8_t      bytesTx;                                                     /*!< SDD_REQ bytes to send (SEL_CMD/SEL_PAR incl) */
+    uint8_t      bitsTx;                                                      /*!< SDD_REQ bits to send, branch bit included    */
+    uint8_t      sdd[RFAL_NFCA_SEL_CASCADE_L3 + 1][RFAL_NFCA_SDD_RES_LEN];    /*!< UID CLn of the levels above, prefix on cl    */
+} rfalNfcaCollBranch;
+
+
+/*! UID prefix tree: the branches still to be explored, deepest one last                                         */
+typedef struct
+{
+    uint8_t              cnt;                                                 /*!< Number of unexplored branches                */
+    rfalNfcaCollBranch   branch[RFAL_NFCA_COLL_TREE_LEN];                     /*!< Unexplored branches                          */
+} rfalNfcaCollTree;
+
 /*
 ******************************************************************************
 * LOCAL FUNCTION PROTOTYPES
 ******************************************************************************
 */
 static uint8_t rfalNfcaCalculateBcc( uint8_t* buf, uint8_t bufLen );
+static ReturnCode rfalNfcaPollerSddResolution( uint8_t devLimit, rfalNfcaCollTree *tree, bool *collPending, rfalNfcaSelRes *selRes, uint8_t *nfcId1, uint8_t *nfcId1Len, SPI* mspiChannel, ST25R3911* mST25, DigitalOut* gpio_cs, InterruptIn* IRQ, DigitalOut* fieldLED_01, DigitalOut* fieldLED_02, DigitalOut* fieldLED_03, DigitalOut* fieldLED_04, DigitalOut* fieldLED_05, DigitalOut* fieldLED_06 );
+static ReturnCode rfalNfcaPresenceProbe( rfalNfcaPresenceEntry *entry, SPI* mspiChannel, ST25R3911* mST25, DigitalOut* gpio_cs, InterruptIn* IRQ, DigitalOut* fieldLED_01, DigitalOut* fieldLED_02, DigitalOut* fieldLED_03, DigitalOut* fieldLED_04, DigitalOut* fieldLED_05, DigitalOut* fieldLED_06 );
+
+
+/*
+******************************************************************************
+* LOCAL VARIABLES
+******************************************************************************
+*/
+static rfalNfcaCollTree gRfalNfcaCollTree;    /*!< UID prefix tree of the ongoing full collision resolution */
 
 
 /*
@@ -160,72 +193,17 @@ static uint8_t rfalNfcaCalculateBcc( uint8_t* buf, uint8_t bufLen )
     return BCC;
 }
 
-/*
-******************************************************************************
-* GLOBAL FUNCTIONS
-******************************************************************************
-*/
-
 /*******************************************************************************/
-ReturnCode rfalNfcaPollerInitialize( SPI*  mspiChannel, ST25R3911* mST25, DigitalOut* gpio_cs, InterruptIn* IRQ, DigitalOut* fieldLED_01, DigitalOut* fieldLED_02, DigitalOut* fieldLED_03, DigitalOut* fieldLED_04, DigitalOut* fieldLED_05, DigitalOut* fieldLED_06 )
+static ReturnCode rfalNfcaPollerSddResolution( uint8_t devLimit, rfalNfcaCollTree *tree, bool *collPending, rfalNfcaSelRes *selRes, uint8_t *nfcId1, uint8_t *nfcId1Len, SPI* mspiChannel, ST25R3911* mST25, DigitalOut* gpio_cs, InterruptIn* IRQ, DigitalOut* fieldLED_01, DigitalOut* fieldLED_02, DigitalOut* fieldLED_03, DigitalOut* fieldLED_04, DigitalOut* fieldLED_05, DigitalOut* fieldLED_06 )
 {
-    ReturnCode ret;
-    
-    EXIT_ON_ERR( ret, rfalSetMode( RFAL_MODE_POLL_NFCA, RFAL_BR_106, RFAL_BR_106, mspiChannel, mST25, gpio_cs, IRQ, fieldLED_01, fieldLED_02, fieldLED_03, fieldLED_04, fieldLED_05, fieldLED_06 )  );
-    rfalSetErrorHandling( RFAL_ERRORHANDLING_NFC );
-    
-    rfalSetGT( RFAL_GT_NFCA );
-    rfalSetFDTListen( RFAL_FDT_LISTEN_NFCA_POLLER );
-    rfalSetFDTPoll( RFAL_FDT_POLL_NFCA_POLLER );
-    
-    return ERR_NONE;
-}
-
-
-/*******************************************************************************/
-ReturnCode rfalNfcaPollerCheckPresence( rfal14443AShortFrameCmd cmd, rfalNfcaSensRes *sensRes, SPI* mspiChannel, ST25R3911* mST25, DigitalOut* gpio_cs, InterruptIn* IRQ, DigitalOut* fieldLED_01, DigitalOut* fieldLED_02, DigitalOut* fieldLED_03, DigitalOut* fieldLED_04, DigitalOut* fieldLED_05, DigitalOut* fieldLED_06 )
-{
-    ReturnCode ret;
-    uint16_t   rcvLen;
-    
-    /* Digital 1.1 6.10.1.3  For Commands ALL_REQ, SENS_REQ, SDD_REQ, and SEL_REQ, the NFC Forum Device      *
-     *              MUST treat receipt of a Listen Frame at a time after FDT(Listen, min) as a Timeour Error */
-    
-    ret = rfalISO14443ATransceiveShortFrame(  cmd, (uint8_t*)sensRes, rfalConvBytesToBits(sizeof(rfalNfcaSensRes)), &rcvLen, RFAL_NFCA_FDTMIN, mspiChannel, mST25, gpio_cs, IRQ, fieldLED_01, fieldLED_02, fieldLED_03, fieldLED_04, fieldLED_05, fieldLED_06 ) ;
-    if( (ERR_NO_MASK(ret) == ERR_RF_COLLISION) || (ERR_NO_MASK(ret) == ERR_CRC)  || (ERR_NO_MASK(ret) == ERR_NOMEM) ||
-        (ERR_NO_MASK(ret) == ERR_FRAMING)      || (ERR_NO_MASK(ret) == ERR_PAR)                                       )
-    {
-       ret = ERR_NONE;
-    }
-
-    return ret;
-}
-
-
-/*******************************************************************************/
-ReturnCode rfalNfcaPollerTechnologyDetection( rfalComplianceMode compMode, rfalNfcaSensRes *sensRes, SPI* mspiChannel, ST25R3911* mST25, DigitalOut* gpio_cs, InterruptIn* IRQ, DigitalOut* fieldLED_01, DigitalOut* fieldLED_02, DigitalOut* fieldLED_03, DigitalOut* fieldLED_04, DigitalOut* fieldLED_05, DigitalOut* fieldLED_06 )
-{
-    ReturnCode ret;
-    
-    EXIT_ON_ERR( ret, rfalNfcaPollerCheckPresence( ((compMode == RFAL_COMPLIANCE_MODE_EMV) ? RFAL_14443A_SHORTFRAME_CMD_WUPA : RFAL_14443A_SHORTFRAME_CMD_REQA), sensRes , mspiChannel, mST25, gpio_cs, IRQ, fieldLED_01, fieldLED_02, fieldLED_03, fieldLED_04, fieldLED_05, fieldLED_06 ) );
-    
-    /* Send SLP_REQ as  Activity 1.1  9.2.3.6 and EMVCo 2.6  9.2.1.3 */
-    if( compMode != RFAL_COMPLIANCE_MODE_ISO)
-    {
-        EXIT_ON_ERR( ret, rfalNfcaPollerSleep( mspiChannel, mST25, gpio_cs, IRQ, fieldLED_01, fieldLED_02, fieldLED_03, fieldLED_04, fieldLED_05, fieldLED_06 )  );
-    }
-    return ERR_NONE;
-}
-
-/*******************************************************************************/
-ReturnCode rfalNfcaPollerSingleCollisionResolution( uint8_t devLimit, bool *collPending, rfalNfcaSelRes *selRes, uint8_t *nfcId1, uint8_t *nfcId1Len, SPI* mspiChannel, ST25R3911* mST25, DigitalOut* gpio_cs, InterruptIn* IRQ, DigitalOut* fieldLED_01, DigitalOut* fieldLED_02, DigitalOut* fieldLED_03, DigitalOut* fieldLED_04, DigitalOut* fieldLED_05, DigitalOut* fieldLED_06 )
-{
-    uint8_t         i;
-    ReturnCode      ret;
-    rfalNfcaSelReq  selReq;
-    uint16_t        bytesRx;
-    uint8_t         bytesTxRx;
-    uint8_t         bitsTxRx;
+    uint8_t             i;
+    ReturnCode          ret;
+    rfalNfcaSelReq      selReq;
+    rfalNfcaCollBranch  path;
+    rfalNfcaCollBranch  *branch;
+    uint16_t            bytesRx;
+    uint8_t             bytesTxRx;
+    uint8_t             bitsTxRx;
     
     /* Check parameters */
     if( (collPending == NULL) || (selRes == NULL) || (nfcId1 == NULL) || (nfcId1Len == NULL) )
@@ -238,6 +216,22 @@ ReturnCode rfalNfcaPollerSingleCollisionResolution( uint8_t devLimit, bool *coll
     *nfcId1Len   = 0;
     ST_MEMSET( nfcId1, 0x00, RFAL_NFCA_CASCADE_3_UID_LEN );
     
+    /*******************************************************************************/
+    /* Start on the deepest branch left by a previous pass if any, otherwise at the root */
+    if( (tree != NULL) && (tree->cnt > 0) )
+    {
+        tree->cnt--;
+        path         = tree->branch[tree->cnt];
+        *collPending = true;
+    }
+    else
+    {
+        ST_MEMSET( (uint8_t*)&path, 0x00, sizeof(rfalNfcaCollBranch) );
+        path.cl      = RFAL_NFCA_SEL_CASCADE_L1;
+        path.bytesTx = RFAL_NFCA_SDD_REQ_LEN;
+        path.bitsTx  = 0;
+    }
+    
     /*******************************************************************************/
     /* Go through all Cascade Levels     Activity 1.1  9.3.4 */
     for( i = RFAL_NFCA_SEL_CASCADE_L1; i <= RFAL_NFCA_SEL_CASCADE_L3; i++)
@@ -245,74 +239,112 @@ ReturnCode rfalNfcaPollerSingleCollisionResolution( uint8_t devLimit, bool *coll
         /* Initialize the SDD_REQ to send for the new cascade level */
         ST_MEMSET( (uint8_t*)&selReq, 0x00, sizeof(rfalNfcaSelReq) );
         selReq.selCmd = rfalNfcaCLn2SELCMD(i);
-                
-        bytesTxRx    = RFAL_NFCA_SDD_REQ_LEN;
-        bitsTxRx     = 0;
         
-        /*******************************************************************************/
-        /* Go through Collision loop */
-        do
+        /* Levels above the branch point are already known: Select them directly */
+        if( i < path.cl )
+        {
+            ST_MEMCPY( ((uint8_t*)&selReq + RFAL_NFCA_SDD_REQ_LEN), path.sdd[i], RFAL_NFCA_SDD_RES_LEN );
+            selReq.bcc = rfalNfcaCalculateBcc( selReq.nfcid1, RFAL_NFCA_CASCADE_1_UID_LEN );
+        }
+        else
         {
-            /* Calculate SEL_PAR with the bytes/bits to be sent */
-            selReq.selPar = rfalNfcaSelPar(bytesTxRx, bitsTxRx);
+            /* On the branch point level resume from the known prefix */
+            if( i == path.cl )
+            {
+                ST_MEMCPY( ((uint8_t*)&selReq + RFAL_NFCA_SDD_REQ_LEN), path.sdd[i], RFAL_NFCA_SDD_RES_LEN );
+                bytesTxRx = path.bytesTx;
+                bitsTxRx  = path.bitsTx;
+            }
+            else
+            {
+                bytesTxRx = RFAL_NFCA_SDD_REQ_LEN;
+                bitsTxRx  = 0;
+            }
             
-            /* Send SDD_REQ (Anticollision frame) - Retry upon timeout  EMVCo 2.6  9.6.1.3 */
-            rfalNfcaTxRetry( ret, rfalISO14443ATransceiveAnticollisionFrame( (uint8_t*)&selReq, &bytesTxRx, &bitsTxRx, &bytesRx, RFAL_NFCA_FDTMIN, mspiChannel, mST25, gpio_cs, IRQ, fieldLED_01, fieldLED_02, fieldLED_03, fieldLED_04, fieldLED_05, fieldLED_06 ) , ((devLimit==0)?RFAL_NFCA_N_RETRANS:0), RFAL_NFCA_T_RETRANS);
+            /*******************************************************************************/
+            /* Go through Collision loop */
+            do
+            {
+                /* Calculate SEL_PAR with the bytes/bits to be sent */
+                selReq.selPar = rfalNfcaSelPar(bytesTxRx, bitsTxRx);
             
-            bytesRx = rfalConvBitsToBytes(bytesRx);
+                /* Send SDD_REQ (Anticollision frame) - Retry upon timeout  EMVCo 2.6  9.6.1.3 */
+                rfalNfcaTxRetry( ret, rfalISO14443ATransceiveAnticollisionFrame( (uint8_t*)&selReq, &bytesTxRx, &bitsTxRx, &bytesRx, RFAL_NFCA_FDTMIN, mspiChannel, mST25, gpio_cs, IRQ, fieldLED_01, fieldLED_02, fieldLED_03, fieldLED_04, fieldLED_05, fieldLED_06 ) , ((devLimit==0)?RFAL_NFCA_N_RETRANS:0), RFAL_NFCA_T_RETRANS);
             
-            if( ret == ERR_RF_COLLISION )
-            {
-                /* Check received length */
-                if( (bytesTxRx + (bitsTxRx ? 1 : 0)) > (RFAL_NFCA_CASCADE_1_UID_LEN + RFAL_NFCA_SDD_REQ_LEN) )
+                bytesRx = rfalConvBitsToBytes(bytesRx);
+            
+                if( ret == ERR_RF_COLLISION )
                 {
-                    return ERR_PROTO;
-                }
-                
-                if( (devLimit == 0) && !(*collPending) )
-                {   
-                    /* Activity 1.0 & 1.1  9.3.4.12: If CON_DEVICES_LIMIT has a value of 0, then 
-                     * NFC Forum Device is configured to perform collision detection only       */
+                    /* Check received length */
+                    if( (bytesTxRx + (bitsTxRx ? 1 : 0)) > (RFAL_NFCA_CASCADE_1_UID_LEN + RFAL_NFCA_SDD_REQ_LEN) )
+                    {
+                        return ERR_PROTO;
+                    }
+            
+                    if( (devLimit == 0) && !(*collPending) )
+                    {   
+                        /* Activity 1.0 & 1.1  9.3.4.12: If CON_DEVICES_LIMIT has a value of 0, then 
+                         * NFC Forum Device is configured to perform collision detection only       */
+                        *collPending = true;
+                        return ERR_IGNORE;
+                    }
+            
                     *collPending = true;
-                    return ERR_IGNORE;
-                }
-                
-                *collPending = true;
-                
-                /* Set and select the collision bit, with the number of bytes/bits successfully TxRx */
-                *((uint8_t*)&selReq + bytesTxRx) |= (1 << bitsTxRx);
-                bitsTxRx++;
-                
-                /* Check if number of bits form a byte */
-                if( bitsTxRx == RFAL_BITS_IN_BYTE )
-                {
-                    bitsTxRx = 0;
-                    bytesTxRx++;
+            
+                    /* Keep the 0 branch of the collision bit for a later pass, this pass follows the 1 branch */
+                    if( (tree != NULL) && (tree->cnt < RFAL_NFCA_COLL_TREE_LEN) )
+                    {
+                        branch  = &tree->branch[tree->cnt++];
+                        *branch = path;
+            
+                        branch->cl = i;
+                        ST_MEMCPY( branch->sdd[i], ((uint8_t*)&selReq + RFAL_NFCA_SDD_REQ_LEN), RFAL_NFCA_SDD_RES_LEN );
+                        branch->sdd[i][(bytesTxRx - RFAL_NFCA_SDD_REQ_LEN)] &= ((1 << bitsTxRx) - 1);
+            
+                        branch->bytesTx = bytesTxRx;
+                        branch->bitsTx  = (bitsTxRx + 1);
+                        if( branch->bitsTx == RFAL_BITS_IN_BYTE )
+                        {
+                            branch->bitsTx = 0;
+                            branch->bytesTx++;
+                        }
+                    }
+            
+                    /* Set and select the collision bit, with the number of bytes/bits successfully TxRx */
+                    *((uint8_t*)&selReq + bytesTxRx) |= (1 << bitsTxRx);
+                    bitsTxRx++;
+            
+                    /* Check if number of bits form a byte */
+                    if( bitsTxRx == RFAL_BITS_IN_BYTE )
+                    {
+                        bitsTxRx = 0;
+                        bytesTxRx++;
+                    }
                 }
+            }while ((ret == ERR_RF_COLLISION) && (RFAL_NFCA_SDD_RES_LEN != bytesRx) ); /* BCC byte should not have collision if NFCID1 data are same */
+            
+            
+            /*******************************************************************************/
+            /* Check if Collision loop has failed */
+            if( ret != ERR_NONE )
+            {
+                return ret;
+            }
+            
+            
+            /* If collisions are to be reported check whether the response is complete */
+            if( (devLimit == 0) && (bytesRx != sizeof(rfalNfcaSddRes)) )
+            {
+                return ERR_PROTO;
+            }
+            
+            /* Check if the received BCC match */
+            if( selReq.bcc != rfalNfcaCalculateBcc( selReq.nfcid1, RFAL_NFCA_CASCADE_1_UID_LEN ) )
+            {
+                return ERR_PROTO;
             }
-        }while ((ret == ERR_RF_COLLISION) && (RFAL_NFCA_SDD_RES_LEN != bytesRx) ); /* BCC byte should not have collision if NFCID1 data are same */
-        
-        
-        /*******************************************************************************/
-        /* Check if Collision loop has failed */
-        if( ret != ERR_NONE )
-        {
-            return ret;
-        }
-        
-        
-        /* If collisions are to be reported check whether the response is complete */
-        if( (devLimit == 0) && (bytesRx != sizeof(rfalNfcaSddRes)) )
-        {
-            return ERR_PROTO;
-        }
-        
-        /* Check if the received BCC match */
-        if( selReq.bcc != rfalNfcaCalculateBcc( selReq.nfcid1, RFAL_NFCA_CASCADE_1_UID_LEN ) )
-        {
-            return ERR_PROTO;
         }
-        
+            
         /*******************************************************************************/
         /* Anticollision OK, Select this Cascade Level */
         selReq.selPar = RFAL_NFCA_SEL_SELPAR;
@@ -330,6 +362,9 @@ ReturnCode rfalNfcaPollerSingleCollisionResolution( uint8_t devLimit, bool *coll
             return ERR_PROTO;
         }
         
+        /* Keep the UID CLn for the branches found on the following levels */
+        ST_MEMCPY( path.sdd[i], ((uint8_t*)&selReq + RFAL_NFCA_SDD_REQ_LEN), RFAL_NFCA_SDD_RES_LEN );
+        
         /*******************************************************************************/
         /* Check cascade byte, if cascade tag then go next cascade level */
         if( (ret == ERR_NONE) && (*selReq.nfcid1 == RFAL_NFCA_SDD_CT) )
@@ -350,11 +385,76 @@ ReturnCode rfalNfcaPollerSingleCollisionResolution( uint8_t devLimit, bool *coll
 }
 
 
+/*
+******************************************************************************
+* GLOBAL FUNCTIONS
+******************************************************************************
+*/
+
+/*******************************************************************************/
+ReturnCode rfalNfcaPollerInitialize( SPI*  mspiChannel, ST25R3911* mST25, DigitalOut* gpio_cs, InterruptIn* IRQ, DigitalOut* fieldLED_01, DigitalOut* fieldLED_02, DigitalOut* fieldLED_03, DigitalOut* fieldLED_04, DigitalOut* fieldLED_05, DigitalOut* fieldLED_06 )
+{
+    ReturnCode ret;
+    
+    EXIT_ON_ERR( ret, rfalSetMode( RFAL_MODE_POLL_NFCA, RFAL_BR_106, RFAL_BR_106, mspiChannel, mST25, gpio_cs, IRQ, fieldLED_01, fieldLED_02, fieldLED_03, fieldLED_04, fieldLED_05, fieldLED_06 )  );
+    rfalSetErrorHandling( RFAL_ERRORHANDLING_NFC );
+    
+    rfalSetGT( RFAL_GT_NFCA );
+    rfalSetFDTListen( RFAL_FDT_LISTEN_NFCA_POLLER );
+    rfalSetFDTPoll( RFAL_FDT_POLL_NFCA_POLLER );
+    
+    return ERR_NONE;
+}
+
+
+/*******************************************************************************/
+ReturnCode rfalNfcaPollerCheckPresence( rfal14443AShortFrameCmd cmd, rfalNfcaSensRes *sensRes, SPI* mspiChannel, ST25R3911* mST25, DigitalOut* gpio_cs, InterruptIn* IRQ, DigitalOut* fieldLED_01, DigitalOut* fieldLED_02, DigitalOut* fieldLED_03, DigitalOut* fieldLED_04, DigitalOut* fieldLED_05, DigitalOut* fieldLED_06 )
+{
+    ReturnCode ret;
+    uint16_t   rcvLen;
+    
+    /* Digital 1.1 6.10.1.3  For Commands ALL_REQ, SENS_REQ, SDD_REQ, and SEL_REQ, the NFC Forum Device      *
+     *              MUST treat receipt of a Listen Frame at a time after FDT(Listen, min) as a Timeour Error */
+    
+    ret = rfalISO14443ATransceiveShortFrame(  cmd, (uint8_t*)sensRes, rfalConvBytesToBits(sizeof(rfalNfcaSensRes)), &rcvLen, RFAL_NFCA_FDTMIN, mspiChannel, mST25, gpio_cs, IRQ, fieldLED_01, fieldLED_02, fieldLED_03, fieldLED_04, fieldLED_05, fieldLED_06 ) ;
+    if( (ERR_NO_MASK(ret) == ERR_RF_COLLISION) || (ERR_NO_MASK(ret) == ERR_CRC)  || (ERR_NO_MASK(ret) == ERR_NOMEM) ||
+        (ERR_NO_MASK(ret) == ERR_FRAMING)      || (ERR_NO_MASK(ret) == ERR_PAR)                                       )
+    {
+       ret = ERR_NONE;
+    }
+
+    return ret;
+}
+
+
+/*******************************************************************************/
+ReturnCode rfalNfcaPollerTechnologyDetection( rfalComplianceMode compMode, rfalNfcaSensRes *sensRes, SPI* mspiChannel, ST25R3911* mST25, DigitalOut* gpio_cs, InterruptIn* IRQ, DigitalOut* fieldLED_01, DigitalOut* fieldLED_02, DigitalOut* fieldLED_03, DigitalOut* fieldLED_04, DigitalOut* fieldLED_05, DigitalOut* fieldLED_06 )
+{
+    ReturnCode ret;
+    
+    EXIT_ON_ERR( ret, rfalNfcaPollerCheckPresence( ((compMode == RFAL_COMPLIANCE_MODE_EMV) ? RFAL_14443A_SHORTFRAME_CMD_WUPA : RFAL_14443A_SHORTFRAME_CMD_REQA), sensRes , mspiChannel, mST25, gpio_cs, IRQ, fieldLED_01, fieldLED_02, fieldLED_03, fieldLED_04, fieldLED_05, fieldLED_06 ) );
+    
+    /* Send SLP_REQ as  Activity 1.1  9.2.3.6 and EMVCo 2.6  9.2.1.3 */
+    if( compMode != RFAL_COMPLIANCE_MODE_ISO)
+    {
+        EXIT_ON_ERR( ret, rfalNfcaPollerSleep( mspiChannel, mST25, gpio_cs, IRQ, fieldLED_01, fieldLED_02, fieldLED_03, fieldLED_04, fieldLED_05, fieldLED_06 )  );
+    }
+    return ERR_NONE;
+}
+
+/*******************************************************************************/
+ReturnCode rfalNfcaPollerSingleCollisionResolution( uint8_t devLimit, bool *collPending, rfalNfcaSelRes *selRes, uint8_t *nfcId1, uint8_t *nfcId1Len, SPI* mspiChannel, ST25R3911* mST25, DigitalOut* gpio_cs, InterruptIn* IRQ, DigitalOut* fieldLED_01, DigitalOut* fieldLED_02, DigitalOut* fieldLED_03, DigitalOut* fieldLED_04, DigitalOut* fieldLED_05, DigitalOut* fieldLED_06 )
+{
+    return rfalNfcaPollerSddResolution( devLimit, NULL, collPending, selRes, nfcId1, nfcId1Len, mspiChannel, mST25, gpio_cs, IRQ, fieldLED_01, fieldLED_02, fieldLED_03, fieldLED_04, fieldLED_05, fieldLED_06 );
+}
+
+
 /*******************************************************************************/
 ReturnCode rfalNfcaPollerFullCollisionResolution( rfalComplianceMode compMode, uint8_t devLimit, rfalNfcaListenDevice *nfcaDevList, uint8_t *devCnt, SPI* mspiChannel, ST25R3911* mST25, DigitalOut* gpio_cs, InterruptIn* IRQ, DigitalOut* fieldLED_01, DigitalOut* fieldLED_02, DigitalOut* fieldLED_03, DigitalOut* fieldLED_04, DigitalOut* fieldLED_05, DigitalOut* fieldLED_06 )
 {
     ReturnCode      ret;
     bool            collPending;
+    bool            fromBranch;
     rfalNfcaSensRes sensRes;
     uint16_t        rcvLen;
     
@@ -365,6 +465,7 @@ ReturnCode rfalNfcaPollerFullCollisionResolution( rfalComplianceMode compMode, u
     
     *devCnt = 0;
     ret     = ERR_NONE;
+    gRfalNfcaCollTree.cnt = 0;
     
     /*******************************************************************************/
     /* Send ALL_REQ before Anticollision if a Sleep was sent before  Activity 1.1  9.3.4.1 and EMVco 2.6  9.3.2.1 */
@@ -421,9 +522,36 @@ ReturnCode rfalNfcaPollerFullCollisionResolution( rfalComplianceMode compMode, u
     
     
     /*******************************************************************************/
+    /* Each pass resumes on the deepest UID branch left by the previous ones instead of re-walking the shared prefix */
     do
     {
-        EXIT_ON_ERR( ret, rfalNfcaPollerSingleCollisionResolution( devLimit, &collPending, &nfcaDevList[*devCnt].selRes, (uint8_t*)&nfcaDevList[*devCnt].nfcId1, (uint8_t*)&nfcaDevList[*devCnt].nfcId1Len, mspiChannel, mST25, gpio_cs, IRQ, fieldLED_01, fieldLED_02, fieldLED_03, fieldLED_04, fieldLED_05, fieldLED_06 )  );
+        fromBranch = (gRfalNfcaCollTree.cnt > 0);
+        
+        ret = rfalNfcaPollerSddResolution( devLimit, &gRfalNfcaCollTree, &collPending, &nfcaDevList[*devCnt].selRes, (uint8_t*)&nfcaDevList[*devCnt].nfcId1, (uint8_t*)&nfcaDevList[*devCnt].nfcId1Len, mspiChannel, mST25, gpio_cs, IRQ, fieldLED_01, fieldLED_02, fieldLED_03, fieldLED_04, fieldLED_05, fieldLED_06 );
+        
+        if( fromBranch && (ret == ERR_TIMEOUT) )
+        {
+            /* No device left under this branch (removed meanwhile). Devices still in READY go  *
+             * back to IDLE upon a SENS_REQ, a second one is sent to bring them to READY again */
+            ret = rfalNfcaPollerCheckPresence( RFAL_14443A_SHORTFRAME_CMD_REQA, &nfcaDevList[*devCnt].sensRes, mspiChannel, mST25, gpio_cs, IRQ, fieldLED_01, fieldLED_02, fieldLED_03, fieldLED_04, fieldLED_05, fieldLED_06 );
+            if( ret == ERR_TIMEOUT )
+            {
+                ret = rfalNfcaPollerCheckPresence( RFAL_14443A_SHORTFRAME_CMD_REQA, &nfcaDevList[*devCnt].sensRes, mspiChannel, mST25, gpio_cs, IRQ, fieldLED_01, fieldLED_02, fieldLED_03, fieldLED_04, fieldLED_05, fieldLED_06 );
+                if( ret == ERR_TIMEOUT )
+                {
+                    /* No more devices found */
+                    return ERR_NONE;
+                }
+            }
+            
+            collPending = true;
+            continue;
+        }
+        
+        if( ret != ERR_NONE )
+        {
+            return ret;
+        }
         
         /* Assign Listen Device */
         nfcaDevList[*devCnt].type    = (rfalNfcaListenDeviceType) (nfcaDevList[*devCnt].selRes.sak & RFAL_NFCA_SEL_RES_CONF_MASK);
@@ -552,4 +680,202 @@ bool rfalNfcaListenerIsSleepReq( uint8_t *buf, uint16_t bufLen )
     return true;
 }
 
+
+/*******************************************************************************/
+static ReturnCode rfalNfcaPresenceProbe( rfalNfcaPresenceEntry *entry, SPI* mspiChannel, ST25R3911* mST25, DigitalOut* gpio_cs, InterruptIn* IRQ, DigitalOut* fieldLED_01, DigitalOut* fieldLED_02, DigitalOut* fieldLED_03, DigitalOut* fieldLED_04, DigitalOut* fieldLED_05, DigitalOut* fieldLED_06 )
+{
+    ReturnCode      ret;
+    rfalNfcaSensRes sensRes;
+    rfalNfcaSelRes  selRes;
+#if RFAL_FEATURE_T1T
+    rfalT1TRidRes   ridRes;
+#endif /* RFAL_FEATURE_T1T */
+    
+    if( entry->probe == RFAL_NFCA_PRESENCE_ISODEP )
+    {
+    #if RFAL_FEATURE_ISO_DEP
+        return rfalIsoDepPresenceCheck( entry->fwt, mspiChannel, mST25, gpio_cs, IRQ, fieldLED_01, fieldLED_02, fieldLED_03, fieldLED_04, fieldLED_05, fieldLED_06 );
+    #else
+        return ERR_NOTSUPP;
+    #endif /* RFAL_FEATURE_ISO_DEP */
+    }
+    
+    /* Wake up the device, sleeping ones included */
+    EXIT_ON_ERR( ret, rfalNfcaPollerCheckPresence( RFAL_14443A_SHORTFRAME_CMD_WUPA, &sensRes, mspiChannel, mST25, gpio_cs, IRQ, fieldLED_01, fieldLED_02, fieldLED_03, fieldLED_04, fieldLED_05, fieldLED_06 ) );
+    
+    switch( entry->probe )
+    {
+        /*******************************************************************************/
+        case RFAL_NFCA_PRESENCE_SELECT:
+            ret = rfalNfcaPollerSelect( entry->dev->nfcId1, entry->dev->nfcId1Len, &selRes, mspiChannel, mST25, gpio_cs, IRQ, fieldLED_01, fieldLED_02, fieldLED_03, fieldLED_04, fieldLED_05, fieldLED_06 );
+            break;
+        
+        /*******************************************************************************/
+        case RFAL_NFCA_PRESENCE_RID:
+        #if RFAL_FEATURE_T1T
+            /* Any NFC-A device answers the WUPA, only a RID_RES with the cached UID shows this T1T is present */
+            rfalT1TPollerInitialize( mspiChannel, mST25, gpio_cs, IRQ, fieldLED_01, fieldLED_02, fieldLED_03, fieldLED_04, fieldLED_05, fieldLED_06 );
+            ret = rfalT1TPollerRid( &ridRes, mspiChannel, mST25, gpio_cs, IRQ, fieldLED_01, fieldLED_02, fieldLED_03, fieldLED_04, fieldLED_05, fieldLED_06 );
+            rfalNfcaPollerInitialize( mspiChannel, mST25, gpio_cs, IRQ, fieldLED_01, fieldLED_02, fieldLED_03, fieldLED_04, fieldLED_05, fieldLED_06 );
+            
+            /* Another T1T answered. A corrupted RID_RES (T1Ts colliding) is taken as present */
+            if( (ret == ERR_NONE) && (ST_BYTECMP( ridRes.uid, entry->dev->nfcId1, RFAL_T1T_UID_LEN ) != 0) )
+            {
+                ret = ERR_TIMEOUT;
+            }
+            return ret;
+        #else
+            return ERR_NOTSUPP;
+        #endif /* RFAL_FEATURE_T1T */
+        
+        /*******************************************************************************/
+        default:
+            return ret;
+    }
+    
+    /* Put the device back to sleep so that the next WUPA is answered  ISO14443-3 6.3 */
+    if( ret != ERR_TIMEOUT )
+    {
+        rfalNfcaPollerSleep( mspiChannel, mST25, gpio_cs, IRQ, fieldLED_01, fieldLED_02, fieldLED_03, fieldLED_04, fieldLED_05, fieldLED_06 );
+    }
+    
+    return ret;
+}
+
+
+/*******************************************************************************/
+ReturnCode rfalNfcaPresenceMonitorInit( rfalNfcaPresenceMonitor *mon, uint32_t latency, rfalNfcaPresenceRemovedCb removedCb )
+{
+    if( (mon == NULL) || (latency == 0) )
+    {
+        return ERR_PARAM;
+    }
+    
+    ST_MEMSET( (uint8_t*)mon, 0x00, sizeof(rfalNfcaPresenceMonitor) );
+    mon->latency   = latency;
+    mon->removedCb = removedCb;
+    
+    return ERR_NONE;
+}
+
+
+/*******************************************************************************/
+ReturnCode rfalNfcaPresenceMonitorAdd( rfalNfcaPresenceMonitor *mon, rfalNfcaListenDevice *dev, bool isIsoDep, uint32_t fwt )
+{
+    uint8_t                i;
+    rfalNfcaPresenceEntry  *entry;
+    
+    if( (mon == NULL) || (dev == NULL) || (isIsoDep && (fwt == 0)) )
+    {
+        return ERR_PARAM;
+    }
+    
+    if( mon->cnt >= RFAL_NFCA_PRESENCE_MAX_DEVS )
+    {
+        return ERR_NOMEM;
+    }
+    
+    entry = &mon->entry[mon->cnt];
+    ST_MEMSET( (uint8_t*)entry, 0x00, sizeof(rfalNfcaPresenceEntry) );
+    
+    if( isIsoDep )
+    {
+    #if RFAL_FEATURE_ISO_DEP
+        /* Only the device activated on ISO-DEP can answer a R(NAK) */
+        for( i = 0; i < mon->cnt; i++ )
+        {
+            if( mon->entry[i].probe == RFAL_NFCA_PRESENCE_ISODEP )
+            {
+                return ERR_PARAM;
+            }
+        }
+        
+        entry->probe = RFAL_NFCA_PRESENCE_ISODEP;
+        entry->fwt   = fwt;
+    #else
+        return ERR_NOTSUPP;
+    #endif /* RFAL_FEATURE_ISO_DEP */
+    }
+    else if( dev->type == RFAL_NFCA_T1T )
+    {
+        entry->probe = RFAL_NFCA_PRESENCE_RID;
+    }
+    else
+    {
+        entry->probe = RFAL_NFCA_PRESENCE_SELECT;
+    }
+    
+    entry->dev       = dev;
+    entry->isPresent = true;
+    
+    /* Spread the first probes over the probe period so that they don't bunch up on a single Run */
+    entry->timer = platformTimerCreate( ((mon->latency / 2) * mon->cnt) / RFAL_NFCA_PRESENCE_MAX_DEVS );
+    mon->cnt++;
+    
+    return ERR_NONE;
+}
+
+
+/*******************************************************************************/
+ReturnCode rfalNfcaPresenceMonitorRun( rfalNfcaPresenceMonitor *mon, SPI* mspiChannel, ST25R3911* mST25, DigitalOut* gpio_cs, InterruptIn* IRQ, DigitalOut* fieldLED_01, DigitalOut* fieldLED_02, DigitalOut* fieldLED_03, DigitalOut* fieldLED_04, DigitalOut* fieldLED_05, DigitalOut* fieldLED_06 )
+{
+    uint8_t                i;
+    uint8_t                j;
+    ReturnCode             ret;
+    rfalNfcaPresenceEntry  *entry;
+    
+    if( mon == NULL )
+    {
+        return ERR_PARAM;
+    }
+    
+    for( i = 0; i < mon->cnt; i++ )
+    {
+        entry = &mon->entry[i];
+        
+        /* A device that missed its last probe is probed again right away */
+        if( !entry->isPresent || ((entry->misses == 0) && !platformTimerIsExpired( entry->timer )) )
+        {
+            continue;
+        }
+        
+        ret = rfalNfcaPresenceProbe( entry, mspiChannel, mST25, gpio_cs, IRQ, fieldLED_01, fieldLED_02, fieldLED_03, fieldLED_04, fieldLED_05, fieldLED_06 );
+        
+        /* The WUPA woke every halted device, those not selected afterwards fell back to IDLE */
+        if( entry->probe != RFAL_NFCA_PRESENCE_ISODEP )
+        {
+            for( j = 0; j < mon->cnt; j++ )
+            {
+                if( mon->entry[j].probe != RFAL_NFCA_PRESENCE_ISODEP )
+                {
+                    mon->entry[j].dev->isSleep = false;
+                }
+            }
+            
+            /* Only a selected device was halted by the SLP_REQ */
+            entry->dev->isSleep = ( (ret == ERR_NONE) && (entry->probe == RFAL_NFCA_PRESENCE_SELECT) );
+        }
+        
+        if( ret != ERR_TIMEOUT )
+        {
+            /* Any answer, even a corrupted one, shows the device is present */
+            entry->misses = 0;
+            entry->timer  = platformTimerCreate( mon->latency / 2 );
+            continue;
+        }
+        
+        if( ++entry->misses >= RFAL_NFCA_PRESENCE_MISS_MAX )
+        {
+            entry->isPresent = false;
+            
+            if( mon->removedCb != NULL )
+            {
+                mon->removedCb( entry->dev );
+            }
+        }
+    }
+    
+    return ERR_NONE;
+}
+
 #endif /* RFAL_FEATURE_NFCA */
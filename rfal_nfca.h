@@ -90,6 +90,8 @@
  * Relax with 3etu: (3*128)/fc as with multiple NFC-A cards, response may take longer (JCOP cards)
  *                            = (1236 + 384)/fc = 1620 / fc                                      */
 #define RFAL_NFCA_FDTMIN          1620
+
+#define RFAL_NFCA_PRESENCE_MAX_DEVS                           4    /*!< Max number of devices kept by a presence monitor                  */
 /*
  ******************************************************************************
  * GLOBAL MACROS
@@ -185,6 +187,40 @@ typedef struct
     bool                     isSleep;                             /*!< Device sleeping flag      */
 } rfalNfcaListenDevice;
 
+
+/*! NFC-A presence probes, cheapest on air first */
+typedef enum {
+    RFAL_NFCA_PRESENCE_ISODEP,                                    /*!< R(NAK) to the device activated on ISO-DEP               */
+    RFAL_NFCA_PRESENCE_SELECT,                                    /*!< WUPA + SEL_REQ with the cached UID on every CLn         */
+    RFAL_NFCA_PRESENCE_RID                                        /*!< WUPA + RID_REQ checking the cached UID (T1T)            */
+} rfalNfcaPresenceProbe;
+
+
+/*! NFC-A presence monitor device entry */
+typedef struct
+{
+    rfalNfcaListenDevice     *dev;                                /*!< Monitored device (type and cached UID)                  */
+    rfalNfcaPresenceProbe    probe;                               /*!< Probe used for the device                               */
+    uint32_t                 fwt;                                 /*!< FWT + dFWT of the ISO-DEP activation (1/fc)             */
+    uint8_t                  misses;                              /*!< Consecutive probes without response                     */
+    uint32_t                 timer;                               /*!< Timer of the next probe                                 */
+    bool                     isPresent;                           /*!< Device presence flag                                    */
+} rfalNfcaPresenceEntry;
+
+
+/*! NFC-A presence monitor callback, called once for each removed device */
+typedef void (* rfalNfcaPresenceRemovedCb)( rfalNfcaListenDevice *dev );
+
+
+/*! NFC-A presence monitor */
+typedef struct
+{
+    rfalNfcaPresenceEntry    entry[RFAL_NFCA_PRESENCE_MAX_DEVS];  /*!< Monitored devices                                       */
+    uint8_t                  cnt;                                 /*!< Number of monitored devices                             */
+    uint32_t                 latency;                             /*!< Max time to report a removal (ms)                       */
+    rfalNfcaPresenceRemovedCb removedCb;                          /*!< Removal callback, may be NULL                           */
+} rfalNfcaPresenceMonitor;
+
 /*
 ******************************************************************************
 * GLOBAL FUNCTION PROTOTYPES
@@ -331,6 +367,10 @@ ReturnCode rfalNfcaPollerSingleCollisionResolution( uint8_t devLimit, bool *coll
  *
  * Performs a full Collision resolution as defined in Activity 1.0 or 1.1  9.3.4
  *
+ * The UID branches not taken on a collision are remembered, so each following
+ * device is resolved starting directly at its branch point (Selecting the 
+ * known upper cascade levels) instead of walking the shared UID prefix again
+ *
  * \param[in]  compMode    : compliance mode to be performed
  * \param[in]  devLimit    : device limit value, and size nfcaDevList
  * \param[out] nfcaDevList : NFC-A listener device info
@@ -375,6 +415,76 @@ ReturnCode rfalNfcaPollerFullCollisionResolution( rfalComplianceMode compMode, u
  */
 bool rfalNfcaListenerIsSleepReq( uint8_t *buf, uint16_t bufLen );
 
+
+/*! 
+ *****************************************************************************
+ * \brief  NFC-A Presence Monitor Initialize
+ *
+ * Initializes a presence monitor with no devices
+ *
+ * \param[out] mon       : presence monitor
+ * \param[in]  latency   : max time between a removal and its report (ms)
+ * \param[in]  removedCb : called for each removed device, may be NULL
+ *
+ * \return ERR_PARAM : Invalid parameters
+ * \return ERR_NONE  : No error
+ *****************************************************************************
+ */
+ReturnCode rfalNfcaPresenceMonitorInit( rfalNfcaPresenceMonitor *mon, uint32_t latency, rfalNfcaPresenceRemovedCb removedCb );
+
+
+/*! 
+ *****************************************************************************
+ * \brief  NFC-A Presence Monitor Add
+ *
+ * Adds a device found by the collision resolution to the monitor and
+ * chooses its probe, the cheapest valid one on air:
+ *  - device activated on ISO-DEP: R(NAK) awaited up to the activation 
+ *    FWT + dFWT, the PICC may use all of it  ISO14443-4 7.2
+ *  - other devices, any UID size: WUPA + SEL_REQ with the cached UID
+ *  - T1T: WUPA + RID_REQ, the RID_RES UID must match the cached one as
+ *    every NFC-A device answers the WUPA
+ *
+ * Every probe but the ISO-DEP one starts with a WUPA, which wakes all the
+ * halted devices in the field. The probed device is selected and halted 
+ * again with SLP_REQ (except T1T), any other device is left on IDLE: the 
+ * isSleep flag of the monitored devices is updated accordingly, devices 
+ * not monitored must be taken as no longer sleeping.
+ * At most one device may be monitored as ISO-DEP, the one currently 
+ * activated
+ *
+ * \param[in,out] mon       : presence monitor
+ * \param[in]     dev       : device to monitor, must stay valid while monitored
+ * \param[in]     isIsoDep  : device is the one activated on ISO-DEP
+ * \param[in]     fwt       : FWT + dFWT of the ISO-DEP activation (1/fc), 
+ *                            ignored if isIsoDep is false
+ *
+ * \return ERR_PARAM   : Invalid parameters
+ * \return ERR_NOMEM   : Monitor is full
+ * \return ERR_NOTSUPP : ISO-DEP support disabled
+ * \return ERR_NONE    : No error
+ *****************************************************************************
+ */
+ReturnCode rfalNfcaPresenceMonitorAdd( rfalNfcaPresenceMonitor *mon, rfalNfcaListenDevice *dev, bool isIsoDep, uint32_t fwt );
+
+
+/*! 
+ *****************************************************************************
+ * \brief  NFC-A Presence Monitor Run
+ *
+ * Probes the present devices whose probe is due. Each device is probed 
+ * every half of the latency budget and, once it misses a probe, again on 
+ * every call until it answers or is declared removed. This function must 
+ * be called periodically, well within the latency budget
+ *
+ * \param[in,out] mon : presence monitor
+ *
+ * \return ERR_PARAM : Invalid parameters
+ * \return ERR_NONE  : No error, removed devices have been reported
+ *****************************************************************************
+ */
+ReturnCode rfalNfcaPresenceMonitorRun( rfalNfcaPresenceMonitor *mon, SPI* mspiChannel, ST25R3911* mST25, DigitalOut* gpio_cs, InterruptIn* IRQ, DigitalOut* fieldLED_01, DigitalOut* fieldLED_02, DigitalOut* fieldLED_03, DigitalOut* fieldLED_04, DigitalOut* fieldLED_05, DigitalOut* fieldLED_06 );
+
 #endif /* RFAL_NFCA_H */
 
 /**
@@ -71,6 +71,9 @@
 
 #define RFAL_NFCB_ACTIVATION_FWT                    (RFAL_NFCB_FWTSENSB + RFAL_NFCB_DFWT_10)  /*!< FWT(SENSB) + dFWT  Digital 1.1  7.9.1.5  */
 
+#define RFAL_NFCB_ADAPTIVE_ROUNDS_MAX                16   /*!< Max rounds of the adaptive collision resolution, bounds it on persistent collisions */
+#define RFAL_NFCB_ADAPTIVE_DEVS_PER_COL              239  /*!< Expected devices per collided slot (x100) used to estimate the unresolved ones  */
+
 /*! Advanced and Extended bit mask in Parameter of SENSB_REQ */
 #define RFAL_NFCB_SENSB_REQ_PARAM                   (RFAL_NFCB_SENSB_REQ_ADV_FEATURE | RFAL_NFCB_SENSB_REQ_EXT_SENSB_RES_SUPPORTED)
 
@@ -493,6 +496,109 @@ ReturnCode rfalNfcbPollerCollisionResolutionSlotted( rfalComplianceMode compMode
 }
 
 
+/*******************************************************************************/
+ReturnCode rfalNfcbPollerCollisionResolutionAdaptive( uint8_t AFI, uint8_t devLimit, rfalNfcbSlots initSlots, rfalNfcbListenDevice *nfcbDevList, uint8_t *devCnt, bool *colPending, SPI* mspiChannel, ST25R3911* mST25, DigitalOut* gpio_cs, InterruptIn* IRQ, DigitalOut* fieldLED_01, DigitalOut* fieldLED_02, DigitalOut* fieldLED_03, DigitalOut* fieldLED_04, DigitalOut* fieldLED_05, DigitalOut* fieldLED_06 )
+{
+    ReturnCode    ret;
+    rfalNfcbSlots slotsNum;
+    uint8_t       slotCode;
+    uint8_t       round;
+    uint8_t       colCnt;
+    uint8_t       emptyCnt;
+    uint8_t       backlog;
+    uint8_t       prevAFI;
+    
+    
+    if( (nfcbDevList == NULL) || (devCnt == NULL) || (colPending == NULL) || (devLimit == 0) || (initSlots > RFAL_NFCB_SLOT_NUM_16) )
+    {
+        return ERR_PARAM;
+    }
+    
+    *devCnt     = 0;
+    *colPending = false;
+    slotsNum    = initSlots;
+    
+    /* Use the requested AFI on the rounds */
+    prevAFI       = gRfalNfcb.AFI;
+    gRfalNfcb.AFI = AFI;
+    
+    for( round = 0; round < RFAL_NFCB_ADAPTIVE_ROUNDS_MAX; round++ )
+    {
+        colCnt      = 0;
+        emptyCnt    = 0;
+        *colPending = false;
+        
+        /* The first round wakes up all devices, the following ones only address the ones not yet put to sleep */
+        ret = rfalNfcbPollerCheckPresence( ((round == 0) ? RFAL_NFCB_SENS_CMD_ALLB_REQ : RFAL_NFCB_SENS_CMD_SENSB_REQ), slotsNum, &nfcbDevList[*devCnt].sensbRes, &nfcbDevList[*devCnt].sensbResLen, mspiChannel, mST25, gpio_cs, IRQ, fieldLED_01, fieldLED_02, fieldLED_03, fieldLED_04, fieldLED_05, fieldLED_06 );
+        if( (ret == ERR_WRONG_STATE) || (ret == ERR_PARAM) )
+        {
+            break;
+        }
+        
+        for( slotCode = 0; (slotCode < rfalNfcbNI2NumberOfSlots(slotsNum)) && (*devCnt < devLimit); slotCode++ )
+        {
+            if( slotCode != 0 )
+            {
+                ret = rfalNfcbPollerSlotMarker( slotCode, &nfcbDevList[*devCnt].sensbRes, &nfcbDevList[*devCnt].sensbResLen, mspiChannel, mST25, gpio_cs, IRQ, fieldLED_01, fieldLED_02, fieldLED_03, fieldLED_04, fieldLED_05, fieldLED_06 );
+            }
+            
+            if( ret == ERR_TIMEOUT )
+            {
+                emptyCnt++;
+            }
+            else if( (ret == ERR_NONE) && (rfalNfcbCheckSensbRes( &nfcbDevList[*devCnt].sensbRes, nfcbDevList[*devCnt].sensbResLen ) == ERR_NONE) )
+            {
+                /* Put the device to sleep so that it doesn't take part on the following rounds */
+                rfalNfcbPollerSleep( nfcbDevList[*devCnt].sensbRes.nfcid0, mspiChannel, mST25, gpio_cs, IRQ, fieldLED_01, fieldLED_02, fieldLED_03, fieldLED_04, fieldLED_05, fieldLED_06 );
+                nfcbDevList[*devCnt].isSleep = true;
+                (*devCnt)++;
+            }
+            else
+            {
+                colCnt++;
+            }
+        }
+        
+        /* Device limit reached, check if any device may have been left behind */
+        if( *devCnt >= devLimit )
+        {
+            *colPending = ((colCnt != 0) || (slotCode < rfalNfcbNI2NumberOfSlots(slotsNum)));
+            ret         = ERR_NONE;
+            break;
+        }
+        
+        /* No collisions: the estimated population has been found */
+        if( colCnt == 0 )
+        {
+            ret = ERR_NONE;
+            break;
+        }
+        
+        *colPending = true;
+        
+        /* Estimate the unresolved devices, a round without empty slots was overloaded so at least double it */
+        backlog = (uint8_t)(((colCnt * RFAL_NFCB_ADAPTIVE_DEVS_PER_COL) + 99) / 100);
+        if( emptyCnt == 0 )
+        {
+            backlog = MAX( backlog, (uint8_t)(rfalNfcbNI2NumberOfSlots(slotsNum) * 2) );
+        }
+        
+        /* Next round opens the smallest number of slots able to hold them */
+        slotsNum = RFAL_NFCB_SLOT_NUM_1;
+        while( (slotsNum < RFAL_NFCB_SLOT_NUM_16) && (rfalNfcbNI2NumberOfSlots(slotsNum) < backlog) )
+        {
+            slotsNum = (rfalNfcbSlots)(slotsNum + 1);
+        }
+        
+        ret = ERR_NONE;
+    }
+    
+    gRfalNfcb.AFI = prevAFI;
+    
+    return ret;
+}
+
+
 /*******************************************************************************/
 uint32_t rfalNfcbTR2ToFDT( uint8_t tr2Code )
 {
@@ -369,6 +369,42 @@ ReturnCode rfalNfcbPollerCollisionResolution( rfalComplianceMode compMode, uint8
 ReturnCode rfalNfcbPollerCollisionResolutionSlotted( rfalComplianceMode compMode, uint8_t devLimit, rfalNfcbSlots initSlots, rfalNfcbSlots endSlots, rfalNfcbListenDevice *nfcbDevList, uint8_t *devCnt, bool *colPending, SPI* mspiChannel, ST25R3911* mST25, DigitalOut* gpio_cs, InterruptIn* IRQ, DigitalOut* fieldLED_01, DigitalOut* fieldLED_02, DigitalOut* fieldLED_03, DigitalOut* fieldLED_04, DigitalOut* fieldLED_05, DigitalOut* fieldLED_06 );
 
 
+/*!
+ *****************************************************************************
+ * \brief  NFC-B Poller Collision Resolution Adaptive
+ *
+ * NFC-B slotted collision resolution where the number of slots of each 
+ * round is chosen from the outcome of the previous one instead of following
+ * a fixed schedule.
+ *
+ * The first round is an ALLB_REQ with \a initSlots, the following ones are 
+ * SENSB_REQ addressing only the devices not yet found, as every device found
+ * is put to sleep with SLPB_REQ. After each round the number of devices still
+ * unresolved is estimated from the collided slots (2.39 devices per collided
+ * slot, twice the slots used if no slot was left empty) and the next round 
+ * opens the smallest number of slots able to hold them.
+ * The resolution stops once a round has no collisions, meaning the estimated
+ * population has been found, or once \a devLimit devices have been found.
+ *
+ * Only devices whose Application Family matches \a AFI take part, the AFI 
+ * configured on the poller is restored afterwards.
+ *
+ * \param[in]  AFI         : Application Family Identifier for the rounds, 
+ *                           RFAL_NFCB_AFI addresses all devices
+ * \param[in]  devLimit    : device limit value, and size nfcbDevList
+ * \param[in]  initSlots   : number of slots to open on the first round
+ * \param[out] nfcbDevList : NFC-B listener device info
+ * \param[out] devCnt      : devices found counter
+ * \param[out] colPending  : flag indicating whether collision are still pending
+ *
+ * \return ERR_WRONG_STATE  : RFAL not initialized or mode not set
+ * \return ERR_PARAM        : Invalid parameters
+ * \return ERR_NONE         : No error
+ *****************************************************************************
+ */
+ReturnCode rfalNfcbPollerCollisionResolutionAdaptive( uint8_t AFI, uint8_t devLimit, rfalNfcbSlots initSlots, rfalNfcbListenDevice *nfcbDevList, uint8_t *devCnt, bool *colPending, SPI* mspiChannel, ST25R3911* mST25, DigitalOut* gpio_cs, InterruptIn* IRQ, DigitalOut* fieldLED_01, DigitalOut* fieldLED_02, DigitalOut* fieldLED_03, DigitalOut* fieldLED_04, DigitalOut* fieldLED_05, DigitalOut* fieldLED_06 );
+
+
 /*!
  *****************************************************************************
  * \brief  NFC-B TR2 code to FDT
@@ -68,6 +68,30 @@
 #define RFAL_NFCF_READ_WO_ENCRYPTION_MIN_LEN       15    /*!< Minimum length for a Check Command   -  T3T  5.4.1 */
 #define RFAL_NFCF_WRITE_WO_ENCRYPTION_MIN_LEN      31    /*!< Minimum length for an Update Command -  T3T  5.5.1 */
 
+#define RFAL_NFCF_FRAME_MAX_LEN                    254   /*!< Max frame length excluding the LEN byte             */
+#define RFAL_NFCF_SERVICECODE_LEN                  2     /*!< Service Code length                                 */
+#define RFAL_NFCF_BLOCKLISTELEM_MAX_LEN            3     /*!< Block List Element max length (3 byte format)       */
+#define RFAL_NFCF_CHECKUPDATE_REQ_HDR_LEN          (RFAL_NFCF_CMD_LEN + RFAL_NFCF_NFCID2_LEN + 2) /*!< CMD + NFCID2 + NoS + NoB   */
+#define RFAL_NFCF_CHECKUPDATE_RES_SF1_POS          (RFAL_NFCF_HEADER_LEN + RFAL_NFCF_NFCID2_LEN)  /*!< Status Flag1 position         */
+#define RFAL_NFCF_CHECKUPDATE_RES_LEN_MIN          (RFAL_NFCF_CHECKUPDATE_RES_SF1_POS + 2)       /*!< LEN + CMD + NFCID2 + SF1 + SF2*/
+#define RFAL_NFCF_CHECK_RES_NOB_POS                RFAL_NFCF_CHECKUPDATE_RES_LEN_MIN             /*!< Check response NoB position   */
+#define RFAL_NFCF_CHECK_RES_DATA_POS               (RFAL_NFCF_CHECK_RES_NOB_POS + 1)             /*!< Check response data position  */
+
+#define RFAL_NFCF_AIB_NBR_POS                      1     /*!< Attribute Information Nbr position        T3T 7.1  */
+#define RFAL_NFCF_AIB_NBW_POS                      2     /*!< Attribute Information Nbw position        T3T 7.1  */
+#define RFAL_NFCF_AIB_NMAXB_POS                    3     /*!< Attribute Information Nmaxb position      T3T 7.1  */
+#define RFAL_NFCF_AIB_WRITEF_POS                   9     /*!< Attribute Information WriteFlag position  T3T 7.1  */
+#define RFAL_NFCF_AIB_RWF_POS                      10    /*!< Attribute Information RWFlag position     T3T 7.1  */
+#define RFAL_NFCF_AIB_LN_POS                       11    /*!< Attribute Information Ln position         T3T 7.1  */
+#define RFAL_NFCF_AIB_CHECKSUM_POS                 14    /*!< Attribute Information Checksum position   T3T 7.1  */
+
+#define RFAL_NFCF_MRT_DELTA                        rfalConv4096fcTo1fc( 2 ) /*!< Margin added to the Maximum Response Time for the card's timer tolerance */
+#define RFAL_NFCF_MRTI_WORST                       0xFF  /*!< MRTI with the longest time: A = B = 7, E = 3      */
+
+#define RFAL_NFCF_DEDUP_SET_LEN                    32    /*!< NFCID2 set size, power of 2 >= 2x RFAL_NFCF_POLL_MAXCARDS */
+#define RFAL_NFCF_DEDUP_EMPTY                      0xFF  /*!< Empty NFCID2 set slot / NFCID2 not found             */
+#define RFAL_NFCF_POLL_ROUNDS_MAX                  4     /*!< Max number of 16 slot Polls on collision resolution */
+
 
 /*
  ******************************************************************************
@@ -76,6 +100,13 @@
  */
 #define rfalNfcfSlots2CardNum( s )                 (s+1) /*!< Converts Time Slot Number (TSN) into num of slots  */
 
+#define rfalNfcfMRTI_A( m )                        ((m) & 0x07)          /*!< MRTI A: response time for the command  */
+#define rfalNfcfMRTI_B( m )                        (((m) >> 3) & 0x07)   /*!< MRTI B: response time per block        */
+#define rfalNfcfMRTI_E( m )                        (((m) >> 6) & 0x03)   /*!< MRTI E: exponent (base 4)              */
+#define rfalNfcfMRTI2Time( m, x )                  rfalConv4096fcTo1fc( ((uint32_t)(x) + 1) << (2 * rfalNfcfMRTI_E( m )) ) /*!< T x (x+1) x 4^E  with T = 256 x 16/fc */
+
+#define rfalNfcfBlockListElemLen( e )              ( ((e)->blockNum > 0xFF) ? 3 : 2 )  /*!< Block List Element length: 2 byte format if the block number fits */
+
 /*
 ******************************************************************************
 * GLOBAL TYPES
@@ -107,12 +138,21 @@ typedef struct
 } rfalNfcfSensfReq;
 
 
+/*! T3T Check/Update frame buffers (static to avoid adding it into stack)                         */
+typedef struct{
+    uint8_t              txBuf[RFAL_NFCF_FRAME_MAX_LEN];                         /*!< Request frame  */
+    uint8_t              rxBuf[RFAL_NFCF_LENGTH_LEN + RFAL_NFCF_FRAME_MAX_LEN];  /*!< Response frame */
+} rfalNfcfT3TBuf;
+
+
 /*
 ******************************************************************************
 * LOCAL VARIABLES
 ******************************************************************************
 */
 static rfalNfcfGreedyF gRfalNfcfGreedyF;   /*!< Activity's NFCF Greedy collection */
+static rfalNfcfT3TBuf  gRfalNfcfT3TBuf;    /*!< T3T Check/Update frame buffers    */
+static uint8_t         gRfalNfcfDedup[RFAL_NFCF_DEDUP_SET_LEN]; /*!< NFCID2 set: index of the device in the list being resolved */
 
 
 /*
@@ -120,7 +160,10 @@ static rfalNfcfGreedyF gRfalNfcfGreedyF;   /*!< Activity's NFCF Greedy collectio
 * LOCAL FUNCTION PROTOTYPES
 ******************************************************************************
 */
-static void rfalNfcfComputeValidSENF( rfalNfcfListenDevice *outDevInfo, uint8_t *curDevIdx, uint8_t devLimit, bool overwrite, bool *nfcDepFound );
+static uint8_t rfalNfcfComputeValidSENF( rfalNfcfListenDevice *outDevInfo, uint8_t *curDevIdx, uint8_t devLimit, bool overwrite, bool *nfcDepFound );
+static uint8_t rfalNfcfDedupLookup( const rfalNfcfListenDevice *outDevInfo, uint8_t devCnt, const uint8_t *nfcid2, uint8_t *slot );
+static ReturnCode rfalNfcfCheckUpdateTxRx( const rfalNfcfListenDevice *dev, uint8_t cmd, const rfalNfcfServBlockListParam *servBlock, const uint8_t *blockData, uint32_t fwt, uint16_t *rcvdLen, SPI* mspiChannel, ST25R3911* mST25, DigitalOut* gpio_cs, InterruptIn* IRQ, DigitalOut* fieldLED_01, DigitalOut* fieldLED_02, DigitalOut* fieldLED_03, DigitalOut* fieldLED_04, DigitalOut* fieldLED_05, DigitalOut* fieldLED_06 );
+static ReturnCode rfalNfcfCheckUpdateBatch( const rfalNfcfListenDevice *dev, const rfalNfcfServBlockListParam *servBlock, uint8_t maxBlocks, uint8_t *rdData, const uint8_t *wrData, SPI* mspiChannel, ST25R3911* mST25, DigitalOut* gpio_cs, InterruptIn* IRQ, DigitalOut* fieldLED_01, DigitalOut* fieldLED_02, DigitalOut* fieldLED_03, DigitalOut* fieldLED_04, DigitalOut* fieldLED_05, DigitalOut* fieldLED_06 );
 
 
 /*
@@ -130,19 +173,70 @@ static void rfalNfcfComputeValidSENF( rfalNfcfListenDevice *outDevInfo, uint8_t
 */
 
 /*******************************************************************************/
-static void rfalNfcfComputeValidSENF( rfalNfcfListenDevice *outDevInfo, uint8_t *curDevIdx, uint8_t devLimit, bool overwrite, bool *nfcDepFound )
+static uint8_t rfalNfcfDedupLookup( const rfalNfcfListenDevice *outDevInfo, uint8_t devCnt, const uint8_t *nfcid2, uint8_t *slot )
+{
+    uint32_t hash;
+    uint8_t  pos;
+    uint8_t  idx;
+    uint8_t  i;
+    
+    /* FNV-1a over the whole NFCID2, its first bytes are shared by most cards */
+    hash = 2166136261UL;
+    for( i = 0; i < RFAL_NFCF_NFCID2_LEN; i++ )
+    {
+        hash = ((hash ^ nfcid2[i]) * 16777619UL);
+    }
+    
+    /* Linear probing until the NFCID2 or an empty slot is found */
+    pos = (uint8_t)(hash & (RFAL_NFCF_DEDUP_SET_LEN - 1));
+    for( i = 0; i < RFAL_NFCF_DEDUP_SET_LEN; i++ )
+    {
+        idx = gRfalNfcfDedup[pos];
+        
+        if( idx == RFAL_NFCF_DEDUP_EMPTY )
+        {
+            *slot = pos;
+            return RFAL_NFCF_DEDUP_EMPTY;
+        }
+        
+        if( !ST_BYTECMP( outDevInfo[idx].sensfRes.NFCID2, nfcid2, RFAL_NFCF_NFCID2_LEN ) )
+        {
+            return idx;
+        }
+        
+        pos = ((pos + 1) & (RFAL_NFCF_DEDUP_SET_LEN - 1));
+    }
+    
+    /* Set full: it holds the first RFAL_NFCF_DEDUP_SET_LEN devices, search the remaining ones */
+    *slot = RFAL_NFCF_DEDUP_EMPTY;
+    for( idx = RFAL_NFCF_DEDUP_SET_LEN; idx < devCnt; idx++ )
+    {
+        if( !ST_BYTECMP( outDevInfo[idx].sensfRes.NFCID2, nfcid2, RFAL_NFCF_NFCID2_LEN ) )
+        {
+            return idx;
+        }
+    }
+    
+    return RFAL_NFCF_DEDUP_EMPTY;
+}
+
+
+/*******************************************************************************/
+static uint8_t rfalNfcfComputeValidSENF( rfalNfcfListenDevice *outDevInfo, uint8_t *curDevIdx, uint8_t devLimit, bool overwrite, bool *nfcDepFound )
 {
     uint8_t             tmpIdx;
+    uint8_t             slot;
+    uint8_t             newDevs;
     bool                duplicate;    
     rfalNfcfSensfResBuf *sensfBuf;
     
+    newDevs = 0;
     
     /*******************************************************************************/
     /* Go through all responses check if valid and duplicates                      */
     /*******************************************************************************/
     while( (gRfalNfcfGreedyF.pollFound > 0) && ((*curDevIdx) < devLimit) )
     {
-        duplicate = false;
         gRfalNfcfGreedyF.pollFound--;
         
         /* Point to received SENSF_RES */
@@ -150,14 +244,8 @@ static void rfalNfcfComputeValidSENF( rfalNfcfListenDevice *outDevInfo, uint8_t
         
         
         /* Check for devices that are already in device list */
-        for( tmpIdx = 0; tmpIdx < (*curDevIdx); tmpIdx++ )
-        {
-            if( !ST_BYTECMP( sensfBuf->SENSF_RES.NFCID2, outDevInfo[tmpIdx].sensfRes.NFCID2, RFAL_NFCF_NFCID2_LEN ) )
-            {
-                duplicate = true;
-                break;
-            }
-        }
+        tmpIdx    = rfalNfcfDedupLookup( outDevInfo, (*curDevIdx), sensfBuf->SENSF_RES.NFCID2, &slot );
+        duplicate = (tmpIdx != RFAL_NFCF_DEDUP_EMPTY);
         
         /* If is a duplicate skip this (and not to overwrite)*/        
         if(duplicate && !overwrite)
@@ -183,6 +271,7 @@ static void rfalNfcfComputeValidSENF( rfalNfcfListenDevice *outDevInfo, uint8_t
             /* overwrite deviceInfo/GRE_SENSF_RES with SENSF_RES */
             outDevInfo[tmpIdx].sensfResLen = (sensfBuf->LEN - RFAL_NFCF_LENGTH_LEN);
             ST_MEMCPY( &outDevInfo[tmpIdx].sensfRes, &sensfBuf->SENSF_RES.CMD, outDevInfo[tmpIdx].sensfResLen );
+            rfalNfcfComputeTimeouts( &outDevInfo[tmpIdx] );
             continue;
         }
         else
@@ -190,15 +279,197 @@ static void rfalNfcfComputeValidSENF( rfalNfcfListenDevice *outDevInfo, uint8_t
             /* fill deviceInfo/GRE_SENSF_RES with new SENSF_RES */
             outDevInfo[(*curDevIdx)].sensfResLen = (sensfBuf->LEN - RFAL_NFCF_LENGTH_LEN);
             ST_MEMCPY( &outDevInfo[(*curDevIdx)].sensfRes, &sensfBuf->SENSF_RES.CMD, outDevInfo[(*curDevIdx)].sensfResLen );            
+            rfalNfcfComputeTimeouts( &outDevInfo[(*curDevIdx)] );
+            
+            if( slot != RFAL_NFCF_DEDUP_EMPTY )
+            {
+                gRfalNfcfDedup[slot] = (*curDevIdx);
+            }
         }
         
         /* Check if this device supports NFC-DEP and signal it (ACTIVITY 1.1   9.3.6.63) */        
         *nfcDepFound = rfalNfcfIsNfcDepSupported( &outDevInfo[(*curDevIdx)] );
                 
         (*curDevIdx)++;
+        newDevs++;
+    }
+    
+    return newDevs;
+}
+
+
+/*******************************************************************************/
+static ReturnCode rfalNfcfCheckUpdateTxRx( const rfalNfcfListenDevice *dev, uint8_t cmd, const rfalNfcfServBlockListParam *servBlock, const uint8_t *blockData, uint32_t fwt, uint16_t *rcvdLen, SPI* mspiChannel, ST25R3911* mST25, DigitalOut* gpio_cs, InterruptIn* IRQ, DigitalOut* fieldLED_01, DigitalOut* fieldLED_02, DigitalOut* fieldLED_03, DigitalOut* fieldLED_04, DigitalOut* fieldLED_05, DigitalOut* fieldLED_06 )
+{
+    ReturnCode                   ret;
+    uint16_t                     txLen;
+    uint8_t                      i;
+    uint8_t                      *txBuf;
+    uint8_t                      *rxBuf;
+    const rfalNfcfBlockListElem  *elem;
+    
+    if( (dev == NULL) || (servBlock == NULL) || (servBlock->servList == NULL) || (servBlock->blockList == NULL) ||
+        (servBlock->numServ == 0) || (servBlock->numServ > RFAL_NFCF_CHECKUPDATE_MAX_SERV) || (servBlock->numBlock == 0) )
+    {
+        return ERR_PARAM;
+    }
+    
+    txBuf = gRfalNfcfT3TBuf.txBuf;
+    rxBuf = gRfalNfcfT3TBuf.rxBuf;
+    txLen = 0;
+    
+    /*******************************************************************************/
+    /* Compute Check/Update frame   T3T 1.0  5.4.1 & 5.5.1  (LEN is added by ST25R3911 automatically) */
+    txBuf[txLen++] = cmd;
+    ST_MEMCPY( &txBuf[txLen], dev->sensfRes.NFCID2, RFAL_NFCF_NFCID2_LEN );
+    txLen += RFAL_NFCF_NFCID2_LEN;
+    
+    txBuf[txLen++] = servBlock->numServ;
+    for( i = 0; i < servBlock->numServ; i++ )
+    {
+        /* Service Codes are sent LSB first */
+        txBuf[txLen++] = (uint8_t)(servBlock->servList[i] & 0xFF);
+        txBuf[txLen++] = (uint8_t)(servBlock->servList[i] >> 8);
+    }
+    
+    txBuf[txLen++] = servBlock->numBlock;
+    for( i = 0; i < servBlock->numBlock; i++ )
+    {
+        elem = &servBlock->blockList[i];
+        
+        if( ((elem->conf & RFAL_NFCF_BLOCKLISTELEM_SERV_MASK) >= servBlock->numServ) || ((txLen + RFAL_NFCF_BLOCKLISTELEM_MAX_LEN) > RFAL_NFCF_FRAME_MAX_LEN) )
+        {
+            return ERR_PARAM;
+        }
+        
+        /* Use the 2 byte format whenever the block number fits  T3T 1.0  5.6.1 */
+        if( rfalNfcfBlockListElemLen( elem ) == 2 )
+        {
+            txBuf[txLen++] = ((elem->conf & (RFAL_NFCF_BLOCKLISTELEM_ACCESS_MASK | RFAL_NFCF_BLOCKLISTELEM_SERV_MASK)) | RFAL_NFCF_BLOCKLISTELEM_LEN_BIT);
+            txBuf[txLen++] = (uint8_t)elem->blockNum;
+        }
+        else
+        {
+            txBuf[txLen++] = (elem->conf & (RFAL_NFCF_BLOCKLISTELEM_ACCESS_MASK | RFAL_NFCF_BLOCKLISTELEM_SERV_MASK));
+            txBuf[txLen++] = (uint8_t)(elem->blockNum & 0xFF);
+            txBuf[txLen++] = (uint8_t)(elem->blockNum >> 8);
+        }
+    }
+    
+    /* Append Block Data on Update */
+    if( blockData != NULL )
+    {
+        if( (txLen + ((uint16_t)servBlock->numBlock * RFAL_NFCF_BLOCK_LEN)) > RFAL_NFCF_FRAME_MAX_LEN )
+        {
+            return ERR_PARAM;
+        }
+        
+        ST_MEMCPY( &txBuf[txLen], blockData, ((uint16_t)servBlock->numBlock * RFAL_NFCF_BLOCK_LEN) );
+        txLen += ((uint16_t)servBlock->numBlock * RFAL_NFCF_BLOCK_LEN);
+    }
+    
+    EXIT_ON_ERR( ret, rfalTransceiveBlockingTxRx( txBuf, txLen, rxBuf, sizeof(gRfalNfcfT3TBuf.rxBuf), rcvdLen, RFAL_TXRX_FLAGS_DEFAULT, fwt, mspiChannel, mST25, gpio_cs, IRQ, fieldLED_01, fieldLED_02, fieldLED_03, fieldLED_04, fieldLED_05, fieldLED_06 ) );
+    
+    /*******************************************************************************/
+    /* Check response: LEN, response code and NFCID2 of the addressed card */
+    if( ((*rcvdLen) < RFAL_NFCF_CHECKUPDATE_RES_LEN_MIN) || (rxBuf[0] != (*rcvdLen)) || (rxBuf[RFAL_NFCF_LENGTH_LEN] != (cmd + 1)) ||
+        ST_BYTECMP( &rxBuf[RFAL_NFCF_HEADER_LEN], dev->sensfRes.NFCID2, RFAL_NFCF_NFCID2_LEN ) )
+    {
+        return ERR_PROTO;
+    }
+    
+    /* Status Flag1 other than 0 signals an error on the card  T3T 1.0  5.4.2 */
+    if( rxBuf[RFAL_NFCF_CHECKUPDATE_RES_SF1_POS] != 0x00 )
+    {
+        return ERR_REQUEST;
+    }
+    
+    return ERR_NONE;
+}
+
+
+/*******************************************************************************/
+static ReturnCode rfalNfcfCheckUpdateBatch( const rfalNfcfListenDevice *dev, const rfalNfcfServBlockListParam *servBlock, uint8_t maxBlocks, uint8_t *rdData, const uint8_t *wrData, SPI* mspiChannel, ST25R3911* mST25, DigitalOut* gpio_cs, InterruptIn* IRQ, DigitalOut* fieldLED_01, DigitalOut* fieldLED_02, DigitalOut* fieldLED_03, DigitalOut* fieldLED_04, DigitalOut* fieldLED_05, DigitalOut* fieldLED_06 )
+{
+    ReturnCode                   ret;
+    rfalNfcfServBlockListParam   frame;
+    uint16_t                     frameServ[RFAL_NFCF_CHECKUPDATE_MAX_SERV];
+    rfalNfcfBlockListElem        frameBlock[RFAL_NFCF_CHECK_MAX_BLOCKS];
+    uint8_t                      servMap[RFAL_NFCF_CHECKUPDATE_MAX_SERV];
+    const rfalNfcfBlockListElem  *elem;
+    uint16_t                     blkIdx;
+    uint16_t                     frameLen;
+    uint16_t                     elemLen;
+    uint16_t                     rcvdLen;
+    uint8_t                      servIdx;
+    
+    if( (servBlock == NULL) || (servBlock->servList == NULL) || (servBlock->blockList == NULL) || (maxBlocks == 0) )
+    {
+        return ERR_PARAM;
+    }
+    
+    maxBlocks       = MIN( maxBlocks, RFAL_NFCF_CHECK_MAX_BLOCKS );
+    frame.servList  = frameServ;
+    frame.blockList = frameBlock;
+    blkIdx          = 0;
+    
+    while( blkIdx < servBlock->numBlock )
+    {
+        /*******************************************************************************/
+        /* Pack as many elements as Nbr/Nbw and the frame length allow, carrying only  *
+         * the services referenced by the packed elements                              */
+        ST_MEMSET( servMap, 0xFF, sizeof(servMap) );
+        frame.numServ  = 0;
+        frame.numBlock = 0;
+        frameLen       = RFAL_NFCF_CHECKUPDATE_REQ_HDR_LEN;
+        
+        while( ((blkIdx + frame.numBlock) < servBlock->numBlock) && (frame.numBlock < maxBlocks) )
+        {
+            elem    = &servBlock->blockList[ (blkIdx + frame.numBlock) ];
+            servIdx = (elem->conf & RFAL_NFCF_BLOCKLISTELEM_SERV_MASK);
+            
+            if( servIdx >= servBlock->numServ )
+            {
+                return ERR_PARAM;
+            }
+            
+            elemLen  = rfalNfcfBlockListElemLen( elem );
+            elemLen += ((servMap[servIdx] == 0xFF) ? RFAL_NFCF_SERVICECODE_LEN : 0);
+            elemLen += ((wrData != NULL) ? RFAL_NFCF_BLOCK_LEN : 0);
+            
+            if( (frameLen + elemLen) > RFAL_NFCF_FRAME_MAX_LEN )
+            {
+                break;
+            }
+            
+            if( servMap[servIdx] == 0xFF )
+            {
+                servMap[servIdx]            = frame.numServ;
+                frameServ[frame.numServ++]  = servBlock->servList[servIdx];
+            }
+            
+            frameBlock[frame.numBlock].conf     = ((elem->conf & ~RFAL_NFCF_BLOCKLISTELEM_SERV_MASK) | servMap[servIdx]);
+            frameBlock[frame.numBlock].blockNum = elem->blockNum;
+            frame.numBlock++;
+            frameLen += elemLen;
+        }
+        
+        if( wrData != NULL )
+        {
+            EXIT_ON_ERR( ret, rfalNfcfPollerUpdate( dev, &frame, &wrData[ (blkIdx * RFAL_NFCF_BLOCK_LEN) ], mspiChannel, mST25, gpio_cs, IRQ, fieldLED_01, fieldLED_02, fieldLED_03, fieldLED_04, fieldLED_05, fieldLED_06 ) );
+        }
+        else
+        {
+            EXIT_ON_ERR( ret, rfalNfcfPollerCheck( dev, &frame, &rdData[ (blkIdx * RFAL_NFCF_BLOCK_LEN) ], ((uint16_t)frame.numBlock * RFAL_NFCF_BLOCK_LEN), &rcvdLen, mspiChannel, mST25, gpio_cs, IRQ, fieldLED_01, fieldLED_02, fieldLED_03, fieldLED_04, fieldLED_05, fieldLED_06 ) );
+        }
+        
+        blkIdx += frame.numBlock;
     }
+    
+    return ERR_NONE;
 }
 
+
 /*
 ******************************************************************************
 * GLOBAL FUNCTIONS
@@ -251,6 +522,8 @@ ReturnCode rfalNfcfPollerCollisionResolution( rfalComplianceMode compMode, uint8
 {
     ReturnCode  ret;
     bool        nfcDepFound;
+    uint8_t     newDevs;
+    uint8_t     round;
     
     if( nfcfDevList == NULL || devCnt == NULL )
     {
@@ -259,6 +532,7 @@ ReturnCode rfalNfcfPollerCollisionResolution( rfalComplianceMode compMode, uint8
             
     *devCnt      = 0;
     nfcDepFound  = false;
+    ST_MEMSET( gRfalNfcfDedup, RFAL_NFCF_DEDUP_EMPTY, sizeof(gRfalNfcfDedup) );
     
     
     /*******************************************************************************************/
@@ -284,12 +558,24 @@ ReturnCode rfalNfcfPollerCollisionResolution( rfalComplianceMode compMode, uint8
          * For now, due to some devices keep generating different nfcid2, we use 1.0  
          * Phones detected: Samsung Galaxy Nexus,Samsung Galaxy S3,Samsung Nexus S */
         *devCnt = 0;
+        ST_MEMSET( gRfalNfcfDedup, RFAL_NFCF_DEDUP_EMPTY, sizeof(gRfalNfcfDedup) );
         
-        ret = rfalNfcfPollerPoll( RFAL_FELICA_16_SLOTS, RFAL_NFCF_SYSTEMCODE, RFAL_FELICA_POLL_RC_NO_REQUEST, gRfalNfcfGreedyF.POLL_F, &gRfalNfcfGreedyF.pollFound, &gRfalNfcfGreedyF.pollCollision, mspiChannel, mST25, gpio_cs, IRQ, fieldLED_01, fieldLED_02, fieldLED_03, fieldLED_04, fieldLED_05, fieldLED_06 ) ;
-        if( ret == ERR_NONE )
+        /* Repeat the Poll only while the previous round had collisions and still found a new NFCID2: *
+         * without collisions every card in the field has answered, and a round with no new NFCID2    *
+         * indicates the remaining collisions are not going to resolve                                */
+        round = 0;
+        do
         {
-            rfalNfcfComputeValidSENF( nfcfDevList, devCnt, devLimit, false, &nfcDepFound );
+            ret = rfalNfcfPollerPoll( RFAL_FELICA_16_SLOTS, RFAL_NFCF_SYSTEMCODE, RFAL_FELICA_POLL_RC_NO_REQUEST, gRfalNfcfGreedyF.POLL_F, &gRfalNfcfGreedyF.pollFound, &gRfalNfcfGreedyF.pollCollision, mspiChannel, mST25, gpio_cs, IRQ, fieldLED_01, fieldLED_02, fieldLED_03, fieldLED_04, fieldLED_05, fieldLED_06 ) ;
+            if( ret != ERR_NONE )
+            {
+                break;
+            }
+            
+            newDevs = rfalNfcfComputeValidSENF( nfcfDevList, devCnt, devLimit, false, &nfcDepFound );
+            round++;
         }
+        while( (newDevs > 0) && (gRfalNfcfGreedyF.pollCollision > 0) && (*devCnt < devLimit) && (round < RFAL_NFCF_POLL_ROUNDS_MAX) );
       
       /*******************************************************************************/
       /* ACTIVITY 1.1 -  9.3.6.63 Check if any device supports NFC DEP               */
@@ -308,6 +594,222 @@ ReturnCode rfalNfcfPollerCollisionResolution( rfalComplianceMode compMode, uint8
 }
 
 
+/*******************************************************************************/
+void rfalNfcfComputeTimeouts( rfalNfcfListenDevice *dev )
+{
+    uint8_t mrti[RFAL_NFCF_MRT_CNT];
+    uint8_t i;
+    
+    if( dev == NULL )
+    {
+        return;
+    }
+    
+    /* PMm: IC code (PAD0) | Request Service, Request Response, Authentication (PAD1) | Check | Update | Other (PAD2) */
+    mrti[RFAL_NFCF_MRT_REQ_SERVICE] = dev->sensfRes.PAD1[0];
+    mrti[RFAL_NFCF_MRT_FIXED]       = dev->sensfRes.PAD1[1];
+    mrti[RFAL_NFCF_MRT_AUTH]        = dev->sensfRes.PAD1[2];
+    mrti[RFAL_NFCF_MRT_CHECK]       = dev->sensfRes.MRTIcheck;
+    mrti[RFAL_NFCF_MRT_UPDATE]      = dev->sensfRes.MRTIupdate;
+    mrti[RFAL_NFCF_MRT_OTHER]       = dev->sensfRes.PAD2;
+    
+    /* T3T 1.0  5.8   Maximum Response Time:  T x [ (B+1) x n + (A+1) ] x 4^E */
+    for( i = 0; i < RFAL_NFCF_MRT_CNT; i++ )
+    {
+        dev->timeouts.base[i]    = rfalNfcfMRTI2Time( mrti[i], rfalNfcfMRTI_A( mrti[i] ) );
+        dev->timeouts.perUnit[i] = rfalNfcfMRTI2Time( mrti[i], rfalNfcfMRTI_B( mrti[i] ) );
+    }
+}
+
+
+/*******************************************************************************/
+uint32_t rfalNfcfGetFwt( const rfalNfcfListenDevice *dev, rfalNfcfCmdClass cmdClass, uint8_t n )
+{
+    /* Profile not computed (base is at least T once decoded), use the worst case of the encoding */
+    if( (dev == NULL) || (cmdClass >= RFAL_NFCF_MRT_CNT) || (dev->timeouts.base[cmdClass] == 0) )
+    {
+        return ( rfalNfcfMRTI2Time( RFAL_NFCF_MRTI_WORST, rfalNfcfMRTI_A( RFAL_NFCF_MRTI_WORST ) ) + 
+                 (rfalNfcfMRTI2Time( RFAL_NFCF_MRTI_WORST, rfalNfcfMRTI_B( RFAL_NFCF_MRTI_WORST ) ) * n) + RFAL_NFCF_MRT_DELTA );
+    }
+    
+    return ( dev->timeouts.base[cmdClass] + (dev->timeouts.perUnit[cmdClass] * n) + RFAL_NFCF_MRT_DELTA );
+}
+
+
+/*******************************************************************************/
+ReturnCode rfalNfcfPollerTransceive( const rfalNfcfListenDevice *dev, rfalNfcfCmdClass cmdClass, uint8_t n, uint8_t *txBuf, uint16_t txBufLen, uint8_t *rxBuf, uint16_t rxBufLen, uint16_t *rcvLen, SPI* mspiChannel, ST25R3911* mST25, DigitalOut* gpio_cs, InterruptIn* IRQ, DigitalOut* fieldLED_01, DigitalOut* fieldLED_02, DigitalOut* fieldLED_03, DigitalOut* fieldLED_04, DigitalOut* fieldLED_05, DigitalOut* fieldLED_06 )
+{
+    if( (dev == NULL) || (txBuf == NULL) || (rxBuf == NULL) || (rcvLen == NULL) )
+    {
+        return ERR_PARAM;
+    }
+    
+    return rfalTransceiveBlockingTxRx( txBuf, txBufLen, rxBuf, rxBufLen, rcvLen, RFAL_TXRX_FLAGS_DEFAULT, rfalNfcfGetFwt( dev, cmdClass, n ), mspiChannel, mST25, gpio_cs, IRQ, fieldLED_01, fieldLED_02, fieldLED_03, fieldLED_04, fieldLED_05, fieldLED_06 );
+}
+
+
+/*******************************************************************************/
+ReturnCode rfalNfcfPollerCheck( const rfalNfcfListenDevice *dev, const rfalNfcfServBlockListParam *servBlock, uint8_t *blockData, uint16_t blockDataLen, uint16_t *rcvdLen, SPI* mspiChannel, ST25R3911* mST25, DigitalOut* gpio_cs, InterruptIn* IRQ, DigitalOut* fieldLED_01, DigitalOut* fieldLED_02, DigitalOut* fieldLED_03, DigitalOut* fieldLED_04, DigitalOut* fieldLED_05, DigitalOut* fieldLED_06 )
+{
+    ReturnCode ret;
+    uint16_t   rxLen;
+    uint16_t   dataLen;
+    
+    if( (dev == NULL) || (servBlock == NULL) || (blockData == NULL) || (rcvdLen == NULL) || (servBlock->numBlock > RFAL_NFCF_CHECK_MAX_BLOCKS) )
+    {
+        return ERR_PARAM;
+    }
+    
+    *rcvdLen = 0;
+    
+    EXIT_ON_ERR( ret, rfalNfcfCheckUpdateTxRx( dev, RFAL_NFCF_CMD_READ_WITHOUT_ENCRYPTION, servBlock, NULL, rfalNfcfGetFwt( dev, RFAL_NFCF_MRT_CHECK, servBlock->numBlock ), &rxLen, mspiChannel, mST25, gpio_cs, IRQ, fieldLED_01, fieldLED_02, fieldLED_03, fieldLED_04, fieldLED_05, fieldLED_06 ) );
+    
+    /* Check if the card returned all requested blocks */
+    dataLen = ((uint16_t)servBlock->numBlock * RFAL_NFCF_BLOCK_LEN);
+    if( (rxLen != (RFAL_NFCF_CHECK_RES_DATA_POS + dataLen)) || (gRfalNfcfT3TBuf.rxBuf[RFAL_NFCF_CHECK_RES_NOB_POS] != servBlock->numBlock) )
+    {
+        return ERR_PROTO;
+    }
+    
+    *rcvdLen = MIN( blockDataLen, dataLen );
+    ST_MEMCPY( blockData, &gRfalNfcfT3TBuf.rxBuf[RFAL_NFCF_CHECK_RES_DATA_POS], *rcvdLen );
+    
+    return ERR_NONE;
+}
+
+
+/*******************************************************************************/
+ReturnCode rfalNfcfPollerUpdate( const rfalNfcfListenDevice *dev, const rfalNfcfServBlockListParam *servBlock, const uint8_t *blockData, SPI* mspiChannel, ST25R3911* mST25, DigitalOut* gpio_cs, InterruptIn* IRQ, DigitalOut* fieldLED_01, DigitalOut* fieldLED_02, DigitalOut* fieldLED_03, DigitalOut* fieldLED_04, DigitalOut* fieldLED_05, DigitalOut* fieldLED_06 )
+{
+    uint16_t   rxLen;
+    
+    if( (dev == NULL) || (servBlock == NULL) || (blockData == NULL) )
+    {
+        return ERR_PARAM;
+    }
+    
+    return rfalNfcfCheckUpdateTxRx( dev, RFAL_NFCF_CMD_WRITE_WITHOUT_ENCRYPTION, servBlock, blockData, rfalNfcfGetFwt( dev, RFAL_NFCF_MRT_UPDATE, servBlock->numBlock ), &rxLen, mspiChannel, mST25, gpio_cs, IRQ, fieldLED_01, fieldLED_02, fieldLED_03, fieldLED_04, fieldLED_05, fieldLED_06 );
+}
+
+
+/*******************************************************************************/
+ReturnCode rfalNfcfPollerCheckBatch( const rfalNfcfListenDevice *dev, const rfalNfcfServBlockListParam *servBlock, uint8_t maxBlocks, uint8_t *blockData, SPI* mspiChannel, ST25R3911* mST25, DigitalOut* gpio_cs, InterruptIn* IRQ, DigitalOut* fieldLED_01, DigitalOut* fieldLED_02, DigitalOut* fieldLED_03, DigitalOut* fieldLED_04, DigitalOut* fieldLED_05, DigitalOut* fieldLED_06 )
+{
+    if( blockData == NULL )
+    {
+        return ERR_PARAM;
+    }
+    
+    return rfalNfcfCheckUpdateBatch( dev, servBlock, maxBlocks, blockData, NULL, mspiChannel, mST25, gpio_cs, IRQ, fieldLED_01, fieldLED_02, fieldLED_03, fieldLED_04, fieldLED_05, fieldLED_06 );
+}
+
+
+/*******************************************************************************/
+ReturnCode rfalNfcfPollerUpdateBatch( const rfalNfcfListenDevice *dev, const rfalNfcfServBlockListParam *servBlock, uint8_t maxBlocks, const uint8_t *blockData, SPI* mspiChannel, ST25R3911* mST25, DigitalOut* gpio_cs, InterruptIn* IRQ, DigitalOut* fieldLED_01, DigitalOut* fieldLED_02, DigitalOut* fieldLED_03, DigitalOut* fieldLED_04, DigitalOut* fieldLED_05, DigitalOut* fieldLED_06 )
+{
+    if( blockData == NULL )
+    {
+        return ERR_PARAM;
+    }
+    
+    return rfalNfcfCheckUpdateBatch( dev, servBlock, maxBlocks, NULL, blockData, mspiChannel, mST25, gpio_cs, IRQ, fieldLED_01, fieldLED_02, fieldLED_03, fieldLED_04, fieldLED_05, fieldLED_06 );
+}
+
+
+/*******************************************************************************/
+ReturnCode rfalNfcfPollerReadNdef( const rfalNfcfListenDevice *dev, rfalNfcfAttribInfo *attrib, uint8_t *ndefBuf, uint32_t ndefBufLen, uint32_t *ndefLen, SPI* mspiChannel, ST25R3911* mST25, DigitalOut* gpio_cs, InterruptIn* IRQ, DigitalOut* fieldLED_01, DigitalOut* fieldLED_02, DigitalOut* fieldLED_03, DigitalOut* fieldLED_04, DigitalOut* fieldLED_05, DigitalOut* fieldLED_06 )
+{
+    ReturnCode                  ret;
+    rfalNfcfServBlockListParam  servBlock;
+    rfalNfcfBlockListElem       blockList[RFAL_NFCF_CHECK_MAX_BLOCKS];
+    rfalNfcfAttribInfo          aib;
+    uint8_t                     aibBuf[RFAL_NFCF_BLOCK_LEN];
+    uint16_t                    serv;
+    uint16_t                    rcvdLen;
+    uint16_t                    checksum;
+    uint16_t                    blockNum;
+    uint32_t                    offset;
+    uint8_t                     i;
+    
+    if( (dev == NULL) || (ndefBuf == NULL) || (ndefLen == NULL) )
+    {
+        return ERR_PARAM;
+    }
+    
+    *ndefLen = 0;
+    
+    serv                 = RFAL_NFCF_SERVICECODE_RDONLY;
+    servBlock.numServ    = 1;
+    servBlock.servList   = &serv;
+    servBlock.numBlock   = 1;
+    servBlock.blockList  = blockList;
+    blockList[0].conf    = 0;
+    blockList[0].blockNum = 0;
+    
+    /*******************************************************************************/
+    /* Read and check the Attribute Information Block   T3T 1.0  7.1               */
+    EXIT_ON_ERR( ret, rfalNfcfPollerCheck( dev, &servBlock, aibBuf, sizeof(aibBuf), &rcvdLen, mspiChannel, mST25, gpio_cs, IRQ, fieldLED_01, fieldLED_02, fieldLED_03, fieldLED_04, fieldLED_05, fieldLED_06 ) );
+    
+    checksum = 0;
+    for( i = 0; i < RFAL_NFCF_AIB_CHECKSUM_POS; i++ )
+    {
+        checksum += aibBuf[i];
+    }
+    
+    if( checksum != (((uint16_t)aibBuf[RFAL_NFCF_AIB_CHECKSUM_POS] << 8) | aibBuf[RFAL_NFCF_AIB_CHECKSUM_POS + 1]) )
+    {
+        return ERR_PROTO;
+    }
+    
+    aib.ver       = aibBuf[0];
+    aib.nbr       = aibBuf[RFAL_NFCF_AIB_NBR_POS];
+    aib.nbw       = aibBuf[RFAL_NFCF_AIB_NBW_POS];
+    aib.nmaxb     = (((uint16_t)aibBuf[RFAL_NFCF_AIB_NMAXB_POS] << 8) | aibBuf[RFAL_NFCF_AIB_NMAXB_POS + 1]);
+    aib.writeFlag = aibBuf[RFAL_NFCF_AIB_WRITEF_POS];
+    aib.rwFlag    = aibBuf[RFAL_NFCF_AIB_RWF_POS];
+    aib.ln        = (((uint32_t)aibBuf[RFAL_NFCF_AIB_LN_POS] << 16) | ((uint32_t)aibBuf[RFAL_NFCF_AIB_LN_POS + 1] << 8) | aibBuf[RFAL_NFCF_AIB_LN_POS + 2]);
+    
+    if( (aib.nbr == 0) || (((aib.ln + (RFAL_NFCF_BLOCK_LEN - 1)) / RFAL_NFCF_BLOCK_LEN) > aib.nmaxb) )
+    {
+        return ERR_PROTO;
+    }
+    
+    if( attrib != NULL )
+    {
+        *attrib = aib;
+    }
+    
+    *ndefLen = aib.ln;
+    if( aib.ln > ndefBufLen )
+    {
+        return ERR_NOMEM;
+    }
+    
+    /*******************************************************************************/
+    /* Stream the NDEF data blocks, Nbr blocks per Check straight into ndefBuf     */
+    offset   = 0;
+    blockNum = 1;
+    
+    while( offset < aib.ln )
+    {
+        servBlock.numBlock = (uint8_t)MIN( MIN( aib.nbr, RFAL_NFCF_CHECK_MAX_BLOCKS ), ((aib.ln - offset + (RFAL_NFCF_BLOCK_LEN - 1)) / RFAL_NFCF_BLOCK_LEN) );
+        
+        for( i = 0; i < servBlock.numBlock; i++ )
+        {
+            blockList[i].conf     = 0;
+            blockList[i].blockNum = (blockNum + i);
+        }
+        
+        EXIT_ON_ERR( ret, rfalNfcfPollerCheck( dev, &servBlock, &ndefBuf[offset], (uint16_t)MIN( (aib.ln - offset), ((uint32_t)servBlock.numBlock * RFAL_NFCF_BLOCK_LEN) ), &rcvdLen, mspiChannel, mST25, gpio_cs, IRQ, fieldLED_01, fieldLED_02, fieldLED_03, fieldLED_04, fieldLED_05, fieldLED_06 ) );
+        
+        offset   += rcvdLen;
+        blockNum += servBlock.numBlock;
+    }
+    
+    return ERR_NONE;
+}
+
+
 /*******************************************************************************/
 bool rfalNfcfListenerIsT3TReq( uint8_t* buf, uint16_t bufLen, uint8_t* nfcid2 )
 {
@@ -72,7 +72,7 @@
 #define RFAL_NFCF_SENSF_RES_LEN_MIN             16      /*!< SENSF_RES minimum length                          */
 #define RFAL_NFCF_SENSF_RES_LEN_MAX             18      /*!< SENSF_RES maximum length                          */
 #define RFAL_NFCF_SENSF_RES_PAD0_LEN            2       /*!< SENSF_RES PAD0 length                             */
-#define RFAL_NFCF_SENSF_RES_PAD1_LEN            2       /*!< SENSF_RES PAD1 length                             */
+#define RFAL_NFCF_SENSF_RES_PAD1_LEN            3       /*!< SENSF_RES PAD1 length                             */
 #define RFAL_NFCF_SENSF_RES_RD_LEN              2       /*!< SENSF_RES Request Data length                     */
 #define RFAL_NFCF_SENSF_RES_BYTE1               1       /*!< SENSF_RES first byte value                        */
 #define RFAL_NFCF_SENSF_SC_LEN                  2       /*!< Felica SENSF_REQ System Code length               */
@@ -96,6 +96,16 @@
 #define RFAL_NFCF_SENSF_NFCID2_BYTE2_NFCDEP      0xFE   /*!< NFCID2 byte2 NFC-DEP support  Digital 1.0 Table 44*/
 
 #define RFAL_NFCF_SYSTEMCODE                     0xFFFF /*!< SENSF_RES Default System Code  Digital 1.0 6.6.1.1 */
+#define RFAL_NFCF_SYSTEMCODE_NDEF                0x12FC /*!< NDEF System Code                 T3T 1.0  4.3    */
+
+#define RFAL_NFCF_BLOCK_LEN                      16     /*!< T3T block length                                  */
+#define RFAL_NFCF_CHECKUPDATE_MAX_SERV           16     /*!< Max number of services on a Check/Update  T3T 5.4 */
+#define RFAL_NFCF_CHECK_MAX_BLOCKS               15     /*!< Max number of blocks fitting a Check response     */
+#define RFAL_NFCF_SERVICECODE_RDONLY             0x000B /*!< NDEF Service Code for Check (read only)  T3T 7.1  */
+#define RFAL_NFCF_SERVICECODE_RDWR               0x0009 /*!< NDEF Service Code for Update (read write) T3T 7.1 */
+#define RFAL_NFCF_BLOCKLISTELEM_SERV_MASK        0x0F   /*!< Block List Element Service Code List Order mask   */
+#define RFAL_NFCF_BLOCKLISTELEM_ACCESS_MASK      0x70   /*!< Block List Element Access Mode mask               */
+#define RFAL_NFCF_BLOCKLISTELEM_LEN_BIT          0x80   /*!< Block List Element 2 byte length bit  T3T 5.6.1   */
 
 
 /*! NFC-F Felica command set   JIS X6319-4  9.1 */
@@ -106,7 +116,9 @@ enum
     RFAL_NFCF_CMD_REQUEST_SERVICE          = 0x02, /*!< verify the existence of Area and Service                       */
     RFAL_NFCF_CMD_REQUEST_RESPONSE         = 0x04, /*!< verify the existence of a card                                 */
     RFAL_NFCF_CMD_READ_WITHOUT_ENCRYPTION  = 0x06, /*!< read Block Data from a Service that requires no authentication */
+    RFAL_NFCF_CMD_READ_WITHOUT_ENCRYPTION_RES  = 0x07, /*!< Check response                                             */
     RFAL_NFCF_CMD_WRITE_WITHOUT_ENCRYPTION = 0x08, /*!< write Block Data to a Service that requires no authentication  */
+    RFAL_NFCF_CMD_WRITE_WITHOUT_ENCRYPTION_RES = 0x09, /*!< Update response                                            */
     RFAL_NFCF_CMD_REQUEST_SYSTEM_CODE      = 0x0c, /*!< acquire the System Code registered to a card                   */
     RFAL_NFCF_CMD_AUTHENTICATION1          = 0x10, /*!< authenticate a card                                            */
     RFAL_NFCF_CMD_AUTHENTICATION2          = 0x12, /*!< allow a card to authenticate a Reader/Writer                   */
@@ -152,14 +164,69 @@ typedef struct
     uint8_t NFCID2[RFAL_NFCF_NFCID2_LEN];       /*!< NFCID2             */
 } rfalNfcfPollDevice;
 
+/*! NFC-F command classes, each with its own Maximum Response Time Information on the PMm  T3T 1.0  5.8 */
+typedef enum
+{
+    RFAL_NFCF_MRT_REQ_SERVICE  = 0,             /*!< Request Service, n: number of nodes     PMm byte 2 */
+    RFAL_NFCF_MRT_FIXED        = 1,             /*!< Request Response and fixed time cmds    PMm byte 3 */
+    RFAL_NFCF_MRT_AUTH         = 2,             /*!< Authentication                          PMm byte 4 */
+    RFAL_NFCF_MRT_CHECK        = 3,             /*!< Check, n: number of blocks              PMm byte 5 */
+    RFAL_NFCF_MRT_UPDATE       = 4,             /*!< Update, n: number of blocks             PMm byte 6 */
+    RFAL_NFCF_MRT_OTHER        = 5,             /*!< Other commands                          PMm byte 7 */
+    RFAL_NFCF_MRT_CNT          = 6              /*!< Number of command classes                          */
+} rfalNfcfCmdClass;
+
+
+/*! NFC-F card timeout profile decoded from the PMm, in 1/fc  T3T 1.0  5.8 */
+typedef struct
+{
+    uint32_t          base[RFAL_NFCF_MRT_CNT];    /*!< Time independent of n:  T x (A+1) x 4^E */
+    uint32_t          perUnit[RFAL_NFCF_MRT_CNT]; /*!< Time per unit of n:     T x (B+1) x 4^E */
+} rfalNfcfTimeouts;
+
+
 /*! NFC-F listener device (PICC) struct  */
 typedef struct
 {
     uint8_t           sensfResLen;              /*!< SENF_RES length    */
     rfalNfcfSensfRes  sensfRes;                 /*!< SENF_RES           */
+    rfalNfcfTimeouts  timeouts;                 /*!< Timeouts from PMm  */
 } rfalNfcfListenDevice;
 
 
+/*! T3T Block List Element  T3T 1.0  5.6.1
+ *  conf holds the Access Mode and the index of the service in the Service Code List, 
+ *  the length bit is handled by the module: 2 byte elements are used whenever blockNum fits */
+typedef struct
+{
+    uint8_t           conf;                     /*!< Access Mode | Service Code List Order */
+    uint16_t          blockNum;                 /*!< Block Number                          */
+} rfalNfcfBlockListElem;
+
+
+/*! T3T Service and Block List of a Check or Update  T3T 1.0  5.4.1 & 5.5.1 */
+typedef struct
+{
+    uint8_t                      numServ;       /*!< Number of services in servList        */
+    const uint16_t              *servList;      /*!< Service Code List                     */
+    uint8_t                      numBlock;      /*!< Number of elements in blockList       */
+    const rfalNfcfBlockListElem *blockList;     /*!< Block List                            */
+} rfalNfcfServBlockListParam;
+
+
+/*! T3T Attribute Information Block  T3T 1.0  7.1 */
+typedef struct
+{
+    uint8_t           ver;                      /*!< Mapping version                       */
+    uint8_t           nbr;                      /*!< Max number of blocks per Check        */
+    uint8_t           nbw;                      /*!< Max number of blocks per Update       */
+    uint16_t          nmaxb;                    /*!< Max number of NDEF data blocks        */
+    uint8_t           writeFlag;                /*!< WriteF: 0x0F a write is in progress   */
+    uint8_t           rwFlag;                   /*!< RWFlag: 0x01 the NDEF is writeable    */
+    uint32_t          ln;                       /*!< NDEF message length (Ln)              */
+} rfalNfcfAttribInfo;
+
+
 /*
 ******************************************************************************
 * GLOBAL FUNCTION PROTOTYPES
@@ -239,6 +306,8 @@ ReturnCode rfalNfcfPollerPoll( rfalFeliCaPollSlots slots, uint16_t sysCode, uint
  * \brief  NFC-F Poller Full Collision Resolution
  *
  * Performs a full Collision resolution as defined in Activity 1.1  9.3.4
+ * The 16 slot Poll is repeated (up to RFAL_NFCF_POLL_ROUNDS_MAX) while a round
+ * had collisions and found a new NFCID2
  *
  * \param[in]  compMode    : compliance mode to be performed
  * \param[in]  devLimit    : device limit value, and size nfcaDevList
@@ -254,6 +323,180 @@ ReturnCode rfalNfcfPollerPoll( rfalFeliCaPollSlots slots, uint16_t sysCode, uint
 ReturnCode rfalNfcfPollerCollisionResolution( rfalComplianceMode compMode, uint8_t devLimit, rfalNfcfListenDevice *nfcfDevList, uint8_t *devCnt,SPI* mspiChannel, ST25R3911* mST25, DigitalOut* gpio_cs, InterruptIn* IRQ, DigitalOut* fieldLED_01, DigitalOut* fieldLED_02, DigitalOut* fieldLED_03, DigitalOut* fieldLED_04, DigitalOut* fieldLED_05, DigitalOut* fieldLED_06 );
 
 
+/*!
+ *****************************************************************************
+ * \brief  NFC-F Compute Timeouts
+ *
+ * Decodes the PMm of the device's SENSF_RES into its timeout profile.
+ * Devices output by rfalNfcfPollerCollisionResolution() already have it
+ * computed, this is only needed for devices built from rfalNfcfPollerPoll()
+ *
+ * \param[in,out] dev : listener device holding a valid SENSF_RES
+ *****************************************************************************
+ */
+void rfalNfcfComputeTimeouts( rfalNfcfListenDevice *dev );
+
+
+/*!
+ *****************************************************************************
+ * \brief  NFC-F Get FWT
+ *
+ * Returns the response timeout of the given command class for this card:
+ *   base + n x perUnit + margin
+ * If the profile has not been computed the worst case time of the PMm 
+ * encoding is returned
+ *
+ * \param[in]  dev      : listener device
+ * \param[in]  cmdClass : command class of the request
+ * \param[in]  n        : number of blocks/nodes of the request, 0 if n/a
+ *
+ * \return the response timeout in 1/fc
+ *****************************************************************************
+ */
+uint32_t rfalNfcfGetFwt( const rfalNfcfListenDevice *dev, rfalNfcfCmdClass cmdClass, uint8_t n );
+
+
+/*!
+ *****************************************************************************
+ * \brief  NFC-F Poller Transceive
+ *
+ * Performs a blocking transceive with the given card using the response 
+ * timeout from its profile for the given command class, so an absent card
+ * or an error is detected after the card's own maximum response time
+ *
+ * \param[in]  dev      : listener device
+ * \param[in]  cmdClass : command class of the request
+ * \param[in]  n        : number of blocks/nodes of the request, 0 if n/a
+ * \param[in]  txBuf    : request frame (without LEN)
+ * \param[in]  txBufLen : request length
+ * \param[out] rxBuf    : location for the response (LEN included)
+ * \param[in]  rxBufLen : size of rxBuf
+ * \param[out] rcvLen   : received length in bytes
+ *
+ * \return ERR_PARAM        : Invalid parameters
+ * \return ERR_TIMEOUT      : Timeout error, no response
+ * \return ERR_NONE         : No error
+ * \return any error returned by rfalTransceiveBlockingTxRx()
+ *****************************************************************************
+ */
+ReturnCode rfalNfcfPollerTransceive( const rfalNfcfListenDevice *dev, rfalNfcfCmdClass cmdClass, uint8_t n, uint8_t *txBuf, uint16_t txBufLen, uint8_t *rxBuf, uint16_t rxBufLen, uint16_t *rcvLen, SPI* mspiChannel, ST25R3911* mST25, DigitalOut* gpio_cs, InterruptIn* IRQ, DigitalOut* fieldLED_01, DigitalOut* fieldLED_02, DigitalOut* fieldLED_03, DigitalOut* fieldLED_04, DigitalOut* fieldLED_05, DigitalOut* fieldLED_06 );
+
+
+/*!
+ *****************************************************************************
+ * \brief  NFC-F Poller Check
+ *
+ * Sends a single Check (Read Without Encryption) with the given Service and
+ * Block List and outputs the received block data.
+ * The response timeout is taken from the card's timeout profile (MRTIcheck)
+ * and the number of blocks, instead of a worst case value.
+ *
+ * \param[in]  dev          : listener device as found on collision resolution
+ * \param[in]  servBlock    : Service and Block List, has to fit a single frame
+ * \param[out] blockData    : location where the block data will be placed
+ * \param[in]  blockDataLen : size of blockData, data not fitting is discarded
+ * \param[out] rcvdLen      : number of bytes placed in blockData
+ *
+ * \return ERR_WRONG_STATE  : RFAL not initialized or incorrect mode
+ * \return ERR_PARAM        : Invalid parameters or list doesn't fit a frame
+ * \return ERR_REQUEST      : card replied with an error status flag
+ * \return ERR_PROTO        : Protocol error detected
+ * \return ERR_TIMEOUT      : Timeout error, no response
+ * \return ERR_NONE         : No error
+ *****************************************************************************
+ */
+ReturnCode rfalNfcfPollerCheck( const rfalNfcfListenDevice *dev, const rfalNfcfServBlockListParam *servBlock, uint8_t *blockData, uint16_t blockDataLen, uint16_t *rcvdLen, SPI* mspiChannel, ST25R3911* mST25, DigitalOut* gpio_cs, InterruptIn* IRQ, DigitalOut* fieldLED_01, DigitalOut* fieldLED_02, DigitalOut* fieldLED_03, DigitalOut* fieldLED_04, DigitalOut* fieldLED_05, DigitalOut* fieldLED_06 );
+
+
+/*!
+ *****************************************************************************
+ * \brief  NFC-F Poller Update
+ *
+ * Sends a single Update (Write Without Encryption) with the given Service and
+ * Block List. The response timeout is taken from the card's timeout profile 
+ * (MRTIupdate) and the number of blocks
+ *
+ * \param[in]  dev          : listener device as found on collision resolution
+ * \param[in]  servBlock    : Service and Block List, has to fit a single frame
+ * \param[in]  blockData    : data to be written, RFAL_NFCF_BLOCK_LEN per element
+ *
+ * \return ERR_WRONG_STATE  : RFAL not initialized or incorrect mode
+ * \return ERR_PARAM        : Invalid parameters or list doesn't fit a frame
+ * \return ERR_REQUEST      : card replied with an error status flag
+ * \return ERR_PROTO        : Protocol error detected
+ * \return ERR_TIMEOUT      : Timeout error, no response
+ * \return ERR_NONE         : No error
+ *****************************************************************************
+ */
+ReturnCode rfalNfcfPollerUpdate( const rfalNfcfListenDevice *dev, const rfalNfcfServBlockListParam *servBlock, const uint8_t *blockData, SPI* mspiChannel, ST25R3911* mST25, DigitalOut* gpio_cs, InterruptIn* IRQ, DigitalOut* fieldLED_01, DigitalOut* fieldLED_02, DigitalOut* fieldLED_03, DigitalOut* fieldLED_04, DigitalOut* fieldLED_05, DigitalOut* fieldLED_06 );
+
+
+/*!
+ *****************************************************************************
+ * \brief  NFC-F Poller Check Batch
+ *
+ * Reads any number of Block List elements issuing as few Check commands as 
+ * possible: each frame is packed with up to maxBlocks elements (card's Nbr) 
+ * and carries only the services referenced by its elements.
+ * Block data is placed in blockData in the order of the Block List.
+ *
+ * \param[in]  dev          : listener device as found on collision resolution
+ * \param[in]  servBlock    : Service and Block List, any length
+ * \param[in]  maxBlocks    : max number of blocks per Check (Nbr)
+ * \param[out] blockData    : location for numBlock * RFAL_NFCF_BLOCK_LEN bytes
+ *
+ * \return ERR_PARAM        : Invalid parameters
+ * \return ERR_NONE         : No error, all blocks read
+ * \return any error returned by rfalNfcfPollerCheck()
+ *****************************************************************************
+ */
+ReturnCode rfalNfcfPollerCheckBatch( const rfalNfcfListenDevice *dev, const rfalNfcfServBlockListParam *servBlock, uint8_t maxBlocks, uint8_t *blockData, SPI* mspiChannel, ST25R3911* mST25, DigitalOut* gpio_cs, InterruptIn* IRQ, DigitalOut* fieldLED_01, DigitalOut* fieldLED_02, DigitalOut* fieldLED_03, DigitalOut* fieldLED_04, DigitalOut* fieldLED_05, DigitalOut* fieldLED_06 );
+
+
+/*!
+ *****************************************************************************
+ * \brief  NFC-F Poller Update Batch
+ *
+ * Writes any number of Block List elements issuing as few Update commands as
+ * possible: each frame is packed with up to maxBlocks elements (card's Nbw)
+ * as long as the frame length allows it.
+ *
+ * \param[in]  dev          : listener device as found on collision resolution
+ * \param[in]  servBlock    : Service and Block List, any length
+ * \param[in]  maxBlocks    : max number of blocks per Update (Nbw)
+ * \param[in]  blockData    : numBlock * RFAL_NFCF_BLOCK_LEN bytes to be written
+ *
+ * \return ERR_PARAM        : Invalid parameters
+ * \return ERR_NONE         : No error, all blocks written
+ * \return any error returned by rfalNfcfPollerUpdate()
+ *****************************************************************************
+ */
+ReturnCode rfalNfcfPollerUpdateBatch( const rfalNfcfListenDevice *dev, const rfalNfcfServBlockListParam *servBlock, uint8_t maxBlocks, const uint8_t *blockData, SPI* mspiChannel, ST25R3911* mST25, DigitalOut* gpio_cs, InterruptIn* IRQ, DigitalOut* fieldLED_01, DigitalOut* fieldLED_02, DigitalOut* fieldLED_03, DigitalOut* fieldLED_04, DigitalOut* fieldLED_05, DigitalOut* fieldLED_06 );
+
+
+/*!
+ *****************************************************************************
+ * \brief  NFC-F Poller Read NDEF
+ *
+ * Reads and checks the Attribute Information Block and streams the whole
+ * NDEF message into ndefBuf, reading Nbr blocks per Check 
+ *
+ * \param[in]  dev          : T3T device (polled with RFAL_NFCF_SYSTEMCODE_NDEF)
+ * \param[out] attrib       : Attribute Information, NULL if not required
+ * \param[out] ndefBuf      : location where the NDEF message will be placed
+ * \param[in]  ndefBufLen   : size of ndefBuf
+ * \param[out] ndefLen      : NDEF message length
+ *
+ * \return ERR_PARAM        : Invalid parameters
+ * \return ERR_PROTO        : Invalid Attribute Information Block
+ * \return ERR_NOMEM        : NDEF message doesn't fit ndefBuf
+ * \return ERR_NONE         : No error
+ * \return any error returned by rfalNfcfPollerCheck()
+ *****************************************************************************
+ */
+ReturnCode rfalNfcfPollerReadNdef( const rfalNfcfListenDevice *dev, rfalNfcfAttribInfo *attrib, uint8_t *ndefBuf, uint32_t ndefBufLen, uint32_t *ndefLen, SPI* mspiChannel, ST25R3911* mST25, DigitalOut* gpio_cs, InterruptIn* IRQ, DigitalOut* fieldLED_01, DigitalOut* fieldLED_02, DigitalOut* fieldLED_03, DigitalOut* fieldLED_04, DigitalOut* fieldLED_05, DigitalOut* fieldLED_06 );
+
+
 /*!
  *****************************************************************************
  * \brief NFC-F Listener is T3T Request
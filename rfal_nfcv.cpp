@@ -73,7 +73,7 @@
 #define RFAL_NFCV_INV_RES_LEN            10    /*!< INVENTORY_RES length                                   */
 #define RFAL_NFCV_CRC_LEN                2     /*!< NFC-V CRC length                                       */
 #define RFAL_NFCV_MAX_SLOTS               16    /*!< NFC-V max number of Slots                                         */
-#define RFAL_NFCV_MAX_GEN_DATA_LEN        (RFAL_NFCV_MAX_BLOCK_LEN + RFAL_NFCV_UID_LEN) /*!< Max number of generic data*/
+#define RFAL_NFCV_MAX_GEN_DATA_LEN        (RFAL_NFCV_MAX_BLOCK_LEN + RFAL_NFCV_UID_LEN + 4) /*!< Max number of generic data: UID, block number, count and data */
 
 #define RFAL_CMD_LEN                      1     /*!< Commandbyte length                                                */
 #define RFAL_NFCV_FLAG_LEN                1     /*!< Flag byte length                                                  */
@@ -82,6 +82,31 @@
 
 #define RFAL_NFCV_MAX_COLL_SUPPORTED      16    /*!< Maximum number of collisions supported by the Anticollision loop  */
 
+#define RFAL_NFCV_ADAPT_1SLOT_MAX         3     /*!< Max estimated devices on a mask to be resolved with 1 slot probes */
+#define RFAL_NFCV_ADAPT_COLL_EST          2     /*!< Estimated devices on a collided slot (2.39 Schoute's estimate)    */
+#define RFAL_NFCV_SLOT_BITS               4     /*!< Number of UID bits selecting the slot in 16 slots mode            */
+#define RFAL_NFCV_INV_RES_HEADER_BITS     16    /*!< INVENTORY_RES bits preceding the UID (FLAGS + DSFID)              */
+
+#define RFAL_NFCV_POP_CHECK_BLOCK         0     /*!< Block read on the addressed presence check                        */
+
+#define RFAL_NFCV_MFG_CODE_LEN            1     /*!< IC Manufacturer code length on custom commands                    */
+
+#define RFAL_NFCV_SYSINFO_DSFID           0x01  /*!< System Information flag: DSFID present       ISO15693 2000 9.3.12 */
+#define RFAL_NFCV_SYSINFO_AFI             0x02  /*!< System Information flag: AFI present                              */
+#define RFAL_NFCV_SYSINFO_MEMSIZE         0x04  /*!< System Information flag: VICC memory size present                 */
+#define RFAL_NFCV_SYSINFO_ICREF           0x08  /*!< System Information flag: IC reference present                     */
+#define RFAL_NFCV_SYSINFO_REQ_FIELD       0x0F  /*!< Extended Get System Information parameter: DSFID, AFI, size, IC  */
+#define RFAL_NFCV_BLOCKLEN_MASK           0x1F  /*!< Block size mask on the memory size field                          */
+#define RFAL_NFCV_STD_MAX_BLOCKS          256   /*!< Max blocks addressable by the non extended commands               */
+#define RFAL_NFCV_READ_BUF_LEN            (RFAL_NFCV_FLAG_LEN + RFAL_NFCV_READ_MAX_DATA_LEN + RFAL_NFCV_CRC_LEN) /*!< Read chunk buffer length */
+
+#define RFAL_NFCV_WRITE_TIME_MS           20    /*!< Max write time of a block (tW) before the response  Digital 2.0 9.8.2 */
+#define RFAL_NFCV_WRITE_TIME_BLOCK_MS     6     /*!< Additional write time of each further block on Write Multiple     */
+
+#define RFAL_NFCV_1OF4_BYTE_US            302   /*!< VCD byte duration with 1 out of 4 coding (4 * 75.52us)  ISO15693-2 7.3 */
+#define RFAL_NFCV_1OF256_BYTE_US          4833  /*!< VCD byte duration with 1 out of 256 coding (256 * 18.88us)              */
+#define RFAL_NFCV_SOF_EOF_US              113   /*!< VCD SOF and EOF duration (75.52us + 37.76us)                           */
+
 #define RFAL_FDT_POLL_MAX                 rfalConvMsTo1fc(20) /*!< */
 
 
@@ -144,12 +169,14 @@ typedef struct
 } rfalNfcvGenericRes;
 
 
-/*! Container for a collision found during Anticollsion loop */
+/*! NFC-V module state */
 typedef struct
 {
-    uint8_t  maskLen;
-    uint8_t  maskVal[RFAL_NFCV_MASKVAL_MAX_LEN];
-}rfalNfcvCollision;
+    bool     fastMode;                              /*!< Fast commands enabled                           */
+    uint8_t  mfgCode;                               /*!< IC Manufacturer code used on fast commands      */
+    bool     isNoFastUidValid;                      /*!< noFastUid holds a device without fast support   */
+    uint8_t  noFastUid[RFAL_NFCV_UID_LEN];          /*!< Last device found not supporting fast commands  */
+} rfalNfcv;
 
 
 /*
@@ -158,6 +185,17 @@ typedef struct
 ******************************************************************************
 */
 static ReturnCode rfalNfvParseError( uint8_t err );
+static void rfalNfcvAdaptPushCollision( rfalNfcvInventoryIt *it, const uint8_t *prefix, uint8_t prefixLen, const uint8_t *uid, uint16_t rcvdLen, uint16_t popEst );
+static void rfalNfcvAdaptEndRound( rfalNfcvInventoryIt *it );
+static rfalNfcvPopEntry* rfalNfcvPopFind( rfalNfcvPopulation *pop, const uint8_t *uid, bool add );
+static uint8_t rfalNfvComputeReq( rfalNfcvGenericReq *req, uint8_t flags, uint8_t cmd, bool isCustom, const uint8_t *uid, const uint8_t *param, uint8_t paramLen );
+static ReturnCode rfalNfvFastTransceive( uint8_t *txBuf, uint16_t txBufLen, uint8_t *rxBuf, uint16_t rxBufLen, uint16_t *rcvLen, SPI* mspiChannel, ST25R3911* mST25, DigitalOut* gpio_cs, InterruptIn* IRQ, DigitalOut* fieldLED_01, DigitalOut* fieldLED_02, DigitalOut* fieldLED_03, DigitalOut* fieldLED_04, DigitalOut* fieldLED_05, DigitalOut* fieldLED_06 );
+static ReturnCode rfalNfvReadBlocks( uint8_t flags, uint8_t* uid, uint8_t cmd, uint8_t fastCmd, const uint8_t *param, uint8_t paramLen, uint8_t* rxBuf, uint16_t rxBufLen, uint16_t *rcvLen, SPI* mspiChannel, ST25R3911* mST25, DigitalOut* gpio_cs, InterruptIn* IRQ, DigitalOut* fieldLED_01, DigitalOut* fieldLED_02, DigitalOut* fieldLED_03, DigitalOut* fieldLED_04, DigitalOut* fieldLED_05, DigitalOut* fieldLED_06 );
+static uint8_t rfalNfvComputeReadReq( rfalNfcvGenericReq *req, uint8_t flags, const uint8_t *uid, uint16_t firstBlock, uint16_t numBlocks, bool isExt, bool isFast );
+static ReturnCode rfalNfvReadDeliver( const rfalNfcvMemReadParam *param, const uint8_t *rxBuf, uint16_t firstBlock, uint16_t numBlocks, uint8_t entryLen, uint8_t blockLen, uint32_t *offset );
+static ReturnCode rfalNfvWriteTransceive( rfalNfcvGenericReq *req, uint8_t reqLen, uint32_t writeTimeMs, SPI* mspiChannel, ST25R3911* mST25, DigitalOut* gpio_cs, InterruptIn* IRQ, DigitalOut* fieldLED_01, DigitalOut* fieldLED_02, DigitalOut* fieldLED_03, DigitalOut* fieldLED_04, DigitalOut* fieldLED_05, DigitalOut* fieldLED_06 );
+static ReturnCode rfalNfvWriteBlocks( uint8_t flags, uint8_t* uid, uint16_t firstBlockNum, uint8_t numOfBlocks, const uint8_t* wrData, uint8_t blockLen, bool isExt, SPI* mspiChannel, ST25R3911* mST25, DigitalOut* gpio_cs, InterruptIn* IRQ, DigitalOut* fieldLED_01, DigitalOut* fieldLED_02, DigitalOut* fieldLED_03, DigitalOut* fieldLED_04, DigitalOut* fieldLED_05, DigitalOut* fieldLED_06 );
+static void rfalNfcvSessionAccount( rfalNfcvSession *session, uint16_t paramLen );
 
 /*
 ******************************************************************************
@@ -165,6 +203,11 @@ static ReturnCode rfalNfvParseError( uint8_t err );
 ******************************************************************************
 */
 
+static rfalNfcv gNfcv;                              /*!< NFC-V module instance                           */
+
+/*! Devices on a 16 slots round from its empty slots, indexed by empty slots per 16: -16*ln(empty/16), capped */
+static const uint8_t rfalNfcvAdaptEmptyEst[RFAL_NFCV_MAX_SLOTS + 1] = { 64, 44, 33, 27, 22, 19, 16, 13, 11, 9, 8, 6, 5, 3, 2, 1, 0 };
+
 /*
 ******************************************************************************
 * LOCAL FUNCTIONS
@@ -191,6 +234,414 @@ static ReturnCode rfalNfvParseError( uint8_t err )
     }
 }
 
+/*******************************************************************************/
+static void rfalNfcvAdaptPushCollision( rfalNfcvInventoryIt *it, const uint8_t *prefix, uint8_t prefixLen, const uint8_t *uid, uint16_t rcvdLen, uint16_t popEst )
+{
+    rfalNfcvCollision *node;
+    uint8_t           mask[RFAL_NFCV_UID_LEN];
+    uint8_t           colBit;
+    uint8_t           i;
+    
+    /* The prefix the devices answered to is common to all of them */
+    ST_MEMSET( mask, 0x00, sizeof(mask) );
+    ST_MEMCPY( mask, prefix, rfalConvBitsToBytes(prefixLen) );
+    if( (prefixLen % 8) != 0 )
+    {
+        mask[(prefixLen / 8)] &= (uint8_t)((1U << (prefixLen % 8)) - 1);
+    }
+    
+    /* So are the UID bits received past it before the collision. A collision on FLAGS/DSFID leaves only the prefix */
+    colBit = prefixLen;
+    if( rcvdLen > (RFAL_NFCV_INV_RES_HEADER_BITS + prefixLen) )
+    {
+        colBit = (uint8_t)MIN( (rcvdLen - RFAL_NFCV_INV_RES_HEADER_BITS), RFAL_NFCV_MASKVAL_MAX_1SLOT_LEN );
+    }
+    
+    for( i = prefixLen; i < colBit; i++ )
+    {
+        mask[(i / 8)] |= (uint8_t)(uid[(i / 8)] & (1U << (i % 8)));
+    }
+    
+    if( colBit >= RFAL_NFCV_MASKVAL_MAX_1SLOT_LEN )
+    {
+        return;                                                   /* Full UID received, not a collision that can be resolved */
+    }
+    
+    /* Many devices expected: resolve the common mask with 16 slots, otherwise split at the collision bit */
+    if( (popEst > RFAL_NFCV_ADAPT_1SLOT_MAX) && (colBit <= RFAL_NFCV_MASKVAL_MAX_16SLOT_LEN) )
+    {
+        if( it->stackCnt >= it->stackLen )
+        {
+            it->dropped = true;
+            return;
+        }
+        
+        node = &it->stack[it->stackCnt++];
+        ST_MEMSET( node, 0x00, sizeof(rfalNfcvCollision) );
+        ST_MEMCPY( node->maskVal, mask, rfalConvBitsToBytes(colBit) );
+        node->maskLen = colBit;
+        node->popEst  = popEst;
+    }
+    else
+    {
+        if( (it->stackCnt + 2) > it->stackLen )
+        {
+            it->dropped = true;
+            return;
+        }
+        
+        /* Both values exist on the collided bit, one child for each */
+        for( i = 0; i < 2; i++ )
+        {
+            node = &it->stack[it->stackCnt++];
+            ST_MEMSET( node, 0x00, sizeof(rfalNfcvCollision) );
+            ST_MEMCPY( node->maskVal, mask, rfalConvBitsToBytes(colBit + 1) );
+            node->maskVal[(colBit / 8)] &= (uint8_t)((1U << (colBit % 8)) - 1);
+            node->maskVal[(colBit / 8)] |= (uint8_t)(i << (colBit % 8));
+            node->maskLen = (colBit + 1);
+            node->popEst  = MAX( (popEst / 2), RFAL_NFCV_ADAPT_COLL_EST );
+        }
+    }
+}
+
+/*******************************************************************************/
+static void rfalNfcvAdaptEndRound( rfalNfcvInventoryIt *it )
+{
+    uint16_t seen;
+    uint16_t popEst;
+    uint16_t perColl;
+    uint16_t i;
+    
+    it->isRoundOngoing = false;
+    
+    seen = (it->roundEmpty + it->roundSingle + it->roundColl);
+    if( (seen == 0) || (it->roundColl == 0) )
+    {
+        return;
+    }
+    
+    /* Devices on the slots seen, from the ratio of empty ones: P(empty) = (1 - 1/16)^n */
+    popEst = rfalNfcvAdaptEmptyEst[ (((it->roundEmpty * RFAL_NFCV_MAX_SLOTS) + (seen / 2)) / seen) ];
+    popEst = ((popEst * seen) / RFAL_NFCV_MAX_SLOTS);
+    
+    /* Those not found on single slots are spread over the collided ones, at least Schoute's estimate each */
+    perColl = RFAL_NFCV_ADAPT_COLL_EST;
+    if( popEst > it->roundSingle )
+    {
+        perColl = MAX( ((popEst - it->roundSingle) / it->roundColl), RFAL_NFCV_ADAPT_COLL_EST );
+    }
+    
+    /* Apply it to the masks pushed for the collided slots of this round */
+    for( i = it->roundBase; i < it->stackCnt; i++ )
+    {
+        it->stack[i].popEst = perColl;
+    }
+}
+
+/*******************************************************************************/
+static rfalNfcvPopEntry* rfalNfcvPopFind( rfalNfcvPopulation *pop, const uint8_t *uid, bool add )
+{
+    rfalNfcvPopEntry *reuse;
+    uint32_t          hash;
+    uint16_t          idx;
+    uint16_t          i;
+    
+    /* FNV-1a over the UID, whose serial number bytes are well spread */
+    hash = 2166136261UL;
+    for( i = 0; i < RFAL_NFCV_UID_LEN; i++ )
+    {
+        hash = ((hash ^ uid[i]) * 16777619UL);
+    }
+    
+    reuse = NULL;
+    idx   = (uint16_t)(hash % pop->entriesLen);
+    
+    /* Linear probing until the UID or a never used entry is found */
+    for( i = 0; i < pop->entriesLen; i++ )
+    {
+        if( pop->entries[idx].state == RFAL_NFCV_POP_ENTRY_FREE )
+        {
+            break;
+        }
+        
+        if( pop->entries[idx].state == RFAL_NFCV_POP_ENTRY_DELETED )
+        {
+            if( reuse == NULL )
+            {
+                reuse = &pop->entries[idx];
+            }
+        }
+        else if( ST_BYTECMP( pop->entries[idx].uid, uid, RFAL_NFCV_UID_LEN ) == 0 )
+        {
+            return &pop->entries[idx];
+        }
+        
+        idx = ((idx + 1) % pop->entriesLen);
+    }
+    
+    if( !add )
+    {
+        return NULL;
+    }
+    
+    /* Prefer a deleted entry, otherwise the free one ending the sequence */
+    if( reuse == NULL )
+    {
+        if( i >= pop->entriesLen )
+        {
+            return NULL;                                          /* Table full */
+        }
+        reuse = &pop->entries[idx];
+    }
+    else
+    {
+        pop->delCnt--;
+    }
+    
+    ST_MEMCPY( reuse->uid, uid, RFAL_NFCV_UID_LEN );
+    reuse->state   = RFAL_NFCV_POP_ENTRY_USED;
+    reuse->isQuiet = false;
+    reuse->missCnt = 0;
+    pop->devCnt++;
+    
+    return reuse;
+}
+
+/*******************************************************************************/
+static uint8_t rfalNfvComputeReq( rfalNfcvGenericReq *req, uint8_t flags, uint8_t cmd, bool isCustom, const uint8_t *uid, const uint8_t *param, uint8_t paramLen )
+{
+    uint8_t msgIt;
+    
+    msgIt = 0;
+    
+    req->REQ_FLAG = (flags & (~RFAL_NFCV_REQ_FLAG_ADDRESS & ~RFAL_NFCV_REQ_FLAG_SELECT));
+    req->CMD      = cmd;
+    
+    /* Custom commands carry the IC Manufacturer code before the UID  ISO15693 2000 10.5 */
+    if( isCustom )
+    {
+        req->payload.data[msgIt++] = gNfcv.mfgCode;
+    }
+    
+    /* Check if request is to be sent in Addressed or Selected mode */
+    if( uid != NULL )
+    {
+        req->REQ_FLAG |= RFAL_NFCV_REQ_FLAG_ADDRESS;
+        ST_MEMCPY( &req->payload.data[msgIt], uid, RFAL_NFCV_UID_LEN );
+        msgIt += RFAL_NFCV_UID_LEN;
+    }
+    else
+    {
+        req->REQ_FLAG |= RFAL_NFCV_REQ_FLAG_SELECT;
+    }
+    
+    ST_MEMCPY( &req->payload.data[msgIt], param, paramLen );
+    msgIt += paramLen;
+    
+    return (RFAL_CMD_LEN + RFAL_NFCV_FLAG_LEN + msgIt);
+}
+
+/*******************************************************************************/
+static ReturnCode rfalNfvFastTransceive( uint8_t *txBuf, uint16_t txBufLen, uint8_t *rxBuf, uint16_t rxBufLen, uint16_t *rcvLen, SPI* mspiChannel, ST25R3911* mST25, DigitalOut* gpio_cs, InterruptIn* IRQ, DigitalOut* fieldLED_01, DigitalOut* fieldLED_02, DigitalOut* fieldLED_03, DigitalOut* fieldLED_04, DigitalOut* fieldLED_05, DigitalOut* fieldLED_06 )
+{
+    ReturnCode  ret;
+    rfalBitRate txBR;
+    rfalBitRate rxBR;
+    
+    /* Fast commands are answered at 53kbps (fc/256), the stream config follows the Rx bit rate */
+    EXIT_ON_ERR( ret, rfalGetBitRate( &txBR, &rxBR ) );
+    EXIT_ON_ERR( ret, rfalSetBitRate( RFAL_BR_KEEP, RFAL_BR_52p97, mspiChannel, mST25, gpio_cs, IRQ, fieldLED_01, fieldLED_02, fieldLED_03, fieldLED_04, fieldLED_05, fieldLED_06 ) );
+    
+    ret = rfalTransceiveBlockingTxRx( txBuf, txBufLen, rxBuf, rxBufLen, rcvLen, RFAL_TXRX_FLAGS_DEFAULT, RFAL_FDT_POLL_MAX, mspiChannel, mST25, gpio_cs, IRQ, fieldLED_01, fieldLED_02, fieldLED_03, fieldLED_04, fieldLED_05, fieldLED_06 ) ;
+    
+    rfalSetBitRate( txBR, rxBR, mspiChannel, mST25, gpio_cs, IRQ, fieldLED_01, fieldLED_02, fieldLED_03, fieldLED_04, fieldLED_05, fieldLED_06 );
+    return ret;
+}
+
+/*******************************************************************************/
+static ReturnCode rfalNfvReadBlocks( uint8_t flags, uint8_t* uid, uint8_t cmd, uint8_t fastCmd, const uint8_t *param, uint8_t paramLen, uint8_t* rxBuf, uint16_t rxBufLen, uint16_t *rcvLen, SPI* mspiChannel, ST25R3911* mST25, DigitalOut* gpio_cs, InterruptIn* IRQ, DigitalOut* fieldLED_01, DigitalOut* fieldLED_02, DigitalOut* fieldLED_03, DigitalOut* fieldLED_04, DigitalOut* fieldLED_05, DigitalOut* fieldLED_06 )
+{
+    ReturnCode         ret;
+    rfalNfcvGenericReq req;
+    rfalNfcvGenericRes *res;
+    uint8_t            reqLen;
+    
+    res = (rfalNfcvGenericRes*)rxBuf;
+    
+    /*******************************************************************************/
+    /* Use the fast variant unless the device is known not to support it           */
+    if( gNfcv.fastMode && !((uid != NULL) && gNfcv.isNoFastUidValid && (ST_BYTECMP( gNfcv.noFastUid, uid, RFAL_NFCV_UID_LEN ) == 0)) )
+    {
+        reqLen = rfalNfvComputeReq( &req, flags, fastCmd, true, uid, param, paramLen );
+        ret    = rfalNfvFastTransceive( (uint8_t*)&req, reqLen, rxBuf, rxBufLen, rcvLen, mspiChannel, mST25, gpio_cs, IRQ, fieldLED_01, fieldLED_02, fieldLED_03, fieldLED_04, fieldLED_05, fieldLED_06 );
+        
+        if( (ret == ERR_NONE) && ((*rcvLen) >= RFAL_NFCV_FLAG_LEN) )
+        {
+            if( !(res->RES_FLAG & RFAL_NFCV_RES_FLAG_ERROR) )
+            {
+                return ERR_NONE;
+            }
+            
+            /* Only an unknown command leads to the fallback, other errors are the device's answer */
+            ret = rfalNfvParseError( *(res->data) );
+            if( (ret != ERR_NOTSUPP) && (ret != ERR_PROTO) )
+            {
+                return ret;
+            }
+        }
+        
+        /* Without an answer at fast rate the device is retried with the standard command */
+        if( (ret != ERR_NONE) && (ret != ERR_TIMEOUT) && (ret != ERR_NOTSUPP) && (ret != ERR_PROTO) && (ret != ERR_FRAMING) && (ret != ERR_CRC) )
+        {
+            return ret;
+        }
+        
+        if( uid != NULL )
+        {
+            ST_MEMCPY( gNfcv.noFastUid, uid, RFAL_NFCV_UID_LEN );
+            gNfcv.isNoFastUidValid = true;
+        }
+    }
+    
+    /*******************************************************************************/
+    reqLen = rfalNfvComputeReq( &req, flags, cmd, false, uid, param, paramLen );
+    
+    /* Transceive Command */
+    ret = rfalTransceiveBlockingTxRx( (uint8_t*)&req, reqLen, rxBuf, rxBufLen, rcvLen, RFAL_TXRX_FLAGS_DEFAULT, RFAL_FDT_POLL_MAX, mspiChannel, mST25, gpio_cs, IRQ, fieldLED_01, fieldLED_02, fieldLED_03, fieldLED_04, fieldLED_05, fieldLED_06 ) ;
+    if( ret != ERR_NONE )
+    {
+        return ret;
+    }
+    
+    /* Check if the response minimum length has been received */
+    if( (*rcvLen) < RFAL_NFCV_FLAG_LEN )
+    {
+        return ERR_PROTO;
+    }
+    
+    /* Check if an error has been signalled */
+    if( res->RES_FLAG & RFAL_NFCV_RES_FLAG_ERROR )
+    {
+        return rfalNfvParseError( *(res->data) );
+    }
+    
+    return ERR_NONE;
+}
+
+/*******************************************************************************/
+static uint8_t rfalNfvComputeReadReq( rfalNfcvGenericReq *req, uint8_t flags, const uint8_t *uid, uint16_t firstBlock, uint16_t numBlocks, bool isExt, bool isFast )
+{
+    uint8_t param[4];
+    uint8_t cmd;
+    
+    /* The number of blocks is encoded minus one */
+    if( isExt )
+    {
+        param[0] = (uint8_t)(firstBlock & 0xFF);
+        param[1] = (uint8_t)(firstBlock >> 8);
+        param[2] = (uint8_t)((numBlocks - 1) & 0xFF);
+        param[3] = (uint8_t)((numBlocks - 1) >> 8);
+        cmd      = (isFast ? RFAL_NFCV_CMD_FAST_EXT_READ_MULTIPLE_BLOCKS : RFAL_NFCF_CMD_EXTENDED_READ_MULTIPLE_BLOCKS);
+        
+        return rfalNfvComputeReq( req, flags, cmd, isFast, uid, param, 4 );
+    }
+    
+    param[0] = (uint8_t)firstBlock;
+    param[1] = (uint8_t)(numBlocks - 1);
+    cmd      = (isFast ? RFAL_NFCV_CMD_FAST_READ_MULTIPLE_BLOCKS : RFAL_NFCF_CMD_READ_MULTIPLE_BLOCKS);
+    
+    return rfalNfvComputeReq( req, flags, cmd, isFast, uid, param, 2 );
+}
+
+/*******************************************************************************/
+static ReturnCode rfalNfvReadDeliver( const rfalNfcvMemReadParam *param, const uint8_t *rxBuf, uint16_t firstBlock, uint16_t numBlocks, uint8_t entryLen, uint8_t blockLen, uint32_t *offset )
+{
+    ReturnCode    ret;
+    const uint8_t *blk;
+    uint16_t      i;
+    
+    /* The security status byte, if present, precedes each block */
+    for( i = 0; i < numBlocks; i++ )
+    {
+        blk = &rxBuf[RFAL_NFCV_FLAG_LEN + (i * entryLen) + (entryLen - blockLen)];
+        
+        if( param->buf != NULL )
+        {
+            ST_MEMCPY( &param->buf[*offset], blk, blockLen );
+        }
+        
+        if( param->cb != NULL )
+        {
+            EXIT_ON_ERR( ret, param->cb( (firstBlock + i), blk, blockLen ) );
+        }
+        
+        (*offset) += blockLen;
+    }
+    
+    return ERR_NONE;
+}
+
+/*******************************************************************************/
+static ReturnCode rfalNfvWriteTransceive( rfalNfcvGenericReq *req, uint8_t reqLen, uint32_t writeTimeMs, SPI* mspiChannel, ST25R3911* mST25, DigitalOut* gpio_cs, InterruptIn* IRQ, DigitalOut* fieldLED_01, DigitalOut* fieldLED_02, DigitalOut* fieldLED_03, DigitalOut* fieldLED_04, DigitalOut* fieldLED_05, DigitalOut* fieldLED_06 )
+{
+    ReturnCode         ret;
+    rfalNfcvGenericRes res;
+    uint16_t           rcvLen;
+    
+    /*******************************************************************************/
+    /* With Option flag the device answers only on an EOF sent after the write     */
+    if( req->REQ_FLAG & RFAL_NFCV_REQ_FLAG_OPTION )
+    {
+        ret = rfalTransceiveBlockingTxRx( (uint8_t*)req, reqLen, (uint8_t*)&res, sizeof(rfalNfcvGenericRes), &rcvLen, RFAL_TXRX_FLAGS_DEFAULT, RFAL_FDT_POLL_NFCV_POLLER, mspiChannel, mST25, gpio_cs, IRQ, fieldLED_01, fieldLED_02, fieldLED_03, fieldLED_04, fieldLED_05, fieldLED_06 ) ;
+        if( ret != ERR_TIMEOUT )
+        {
+            return ((ret == ERR_NONE) ? ERR_PROTO : ret);
+        }
+        
+        platformDelay( writeTimeMs );
+        
+        /* Response is received with its CRC */
+        EXIT_ON_ERR( ret, rfalISO15693TransceiveEOF( (uint8_t*)&res, sizeof(rfalNfcvGenericRes), &rcvLen, mspiChannel, mST25, gpio_cs, IRQ, fieldLED_01, fieldLED_02, fieldLED_03, fieldLED_04, fieldLED_05, fieldLED_06 ) );
+    }
+    else
+    {
+        EXIT_ON_ERR( ret, rfalTransceiveBlockingTxRx( (uint8_t*)req, reqLen, (uint8_t*)&res, sizeof(rfalNfcvGenericRes), &rcvLen, RFAL_TXRX_FLAGS_DEFAULT, rfalConvMsTo1fc(writeTimeMs), mspiChannel, mST25, gpio_cs, IRQ, fieldLED_01, fieldLED_02, fieldLED_03, fieldLED_04, fieldLED_05, fieldLED_06 ) );
+    }
+    
+    /* Check if the response minimum length has been received */
+    if( rcvLen < RFAL_NFCV_FLAG_LEN )
+    {
+        return ERR_PROTO;
+    }
+    
+    /* Check if an error has been signalled */
+    if( res.RES_FLAG & RFAL_NFCV_RES_FLAG_ERROR )
+    {
+        return rfalNfvParseError( *res.data );
+    }
+    
+    return ERR_NONE;
+}
+
+/*******************************************************************************/
+static void rfalNfcvSessionAccount( rfalNfcvSession *session, uint16_t paramLen )
+{
+    uint16_t reqLen;
+    
+    reqLen = (RFAL_NFCV_FLAG_LEN + RFAL_CMD_LEN + paramLen);
+    
+    session->cmdCnt++;
+    if( session->isSelected )
+    {
+        session->txAirtime    += rfalNfcvGetRequestAirtime( reqLen );
+        session->savedAirtime += (rfalNfcvGetRequestAirtime( (reqLen + RFAL_NFCV_UID_LEN) ) - rfalNfcvGetRequestAirtime( reqLen ));
+    }
+    else
+    {
+        session->txAirtime    += rfalNfcvGetRequestAirtime( (reqLen + RFAL_NFCV_UID_LEN) );
+    }
+}
+
 /*
 ******************************************************************************
 * GLOBAL FUNCTIONS
@@ -205,6 +656,9 @@ ReturnCode rfalNfcvPollerInitialize( SPI* mspiChannel, ST25R3911* mST25, Digital
     EXIT_ON_ERR( ret, rfalSetMode( RFAL_MODE_POLL_NFCV, RFAL_BR_26p48, RFAL_BR_26p48, mspiChannel, mST25, gpio_cs, IRQ, fieldLED_01, fieldLED_02, fieldLED_03, fieldLED_04, fieldLED_05, fieldLED_06 )  );
     rfalSetErrorHandling( RFAL_ERRORHANDLING_NFC );
     
+    ST_MEMSET( &gNfcv, 0x00, sizeof(rfalNfcv) );
+    gNfcv.mfgCode = RFAL_NFCV_MFG_CODE_ST;
+    
     rfalSetGT( RFAL_GT_NFCV_ADJUSTED );
     rfalSetFDTListen( RFAL_FDT_LISTEN_NFCV_POLLER );
     rfalSetFDTPoll( RFAL_FDT_POLL_NFCV_POLLER );
@@ -273,6 +727,7 @@ ReturnCode rfalNfcvPollerCollisionResolution( uint8_t devLimit, rfalNfcvListenDe
     uint16_t          rcvdLen;
     uint8_t           colIt;
     uint8_t           colCnt;
+    bool              colDropped;
    /* bool              colPending; */
     rfalNfcvCollision colFound[RFAL_NFCV_MAX_COLL_SUPPORTED];
     
@@ -287,6 +742,7 @@ ReturnCode rfalNfcvPollerCollisionResolution( uint8_t devLimit, rfalNfcvListenDe
     *devCnt = 0;
     colIt         = 0;
     colCnt        = 0;
+    colDropped    = false;
    /* colPending    = false; */
     ST_MEMSET(nfcvDevList, 0x00, (sizeof(rfalNfcvListenDevice)*devLimit) );
     ST_MEMSET(colFound, 0x00, (sizeof(rfalNfcvCollision)*RFAL_NFCV_MAX_COLL_SUPPORTED) );
@@ -371,6 +827,10 @@ ReturnCode rfalNfcvPollerCollisionResolution( uint8_t devLimit, rfalNfcvListenDe
                         ST_MEMCPY(colFound[colCnt].maskVal, nfcvDevList[(*devCnt)].InvRes.UID, RFAL_NFCV_UID_LEN);
                         colCnt++;
                     }
+                    else
+                    {
+                        colDropped = true;  /* Devices behind this collision won't be found */
+                    }
                 }
             }
             
@@ -388,29 +848,217 @@ ReturnCode rfalNfcvPollerCollisionResolution( uint8_t devLimit, rfalNfcvListenDe
         while( slotNum < RFAL_NFCV_MAX_SLOTS );  /* Slot loop             */
     }while( colIt < colCnt );                    /* Collisions found loop */
     
-    return ERR_NONE;
+    /* Signal an incomplete inventory, the devices found are kept on the list */
+    return (colDropped ? ERR_RF_COLLISION : ERR_NONE);
 }
 
 /*******************************************************************************/
-ReturnCode rfalNfvPollerSleep( uint8_t flags, uint8_t* uid, SPI* mspiChannel, ST25R3911* mST25, DigitalOut* gpio_cs, InterruptIn* IRQ, DigitalOut* fieldLED_01, DigitalOut* fieldLED_02, DigitalOut* fieldLED_03, DigitalOut* fieldLED_04, DigitalOut* fieldLED_05, DigitalOut* fieldLED_06 )
+ReturnCode rfalNfcvPollerCollisionResolutionAdaptive( uint8_t devLimit, uint16_t popHint, bool earlyStop, rfalNfcvListenDevice *nfcvDevList, uint8_t *devCnt, uint16_t *slotCnt, SPI* mspiChannel, ST25R3911* mST25, DigitalOut* gpio_cs, InterruptIn* IRQ, DigitalOut* fieldLED_01, DigitalOut* fieldLED_02, DigitalOut* fieldLED_03, DigitalOut* fieldLED_04, DigitalOut* fieldLED_05, DigitalOut* fieldLED_06 )
 {
-    ReturnCode      ret;
-    rfalNfcvSlpvReq slpReq;
-    uint8_t         rxBuf;    /* dummy buffer, just to perform Rx */
+    ReturnCode          ret;
+    rfalNfcvInventoryIt it;
+    rfalNfcvCollision   stack[RFAL_NFCV_ADAPT_MAX_NODES];
     
-    if( uid == NULL )
+    if( (nfcvDevList == NULL) || (devCnt == NULL) || (devLimit == 0) )
     {
         return ERR_PARAM;
     }
     
-    /* Compute SLPV_REQ */
-    slpReq.REQ_FLAG = (flags | RFAL_NFCV_REQ_FLAG_ADDRESS);   /* Should be with UID according Digital 2.0 (Candidate) 9.7.1.1 */
-    slpReq.CMD      = RFAL_NFCF_CMD_SLPV;
-    ST_MEMCPY( slpReq.UID, uid, RFAL_NFCV_UID_LEN );
+    /* Initialize parameters */
+    *devCnt = 0;
+    ST_MEMSET(nfcvDevList, 0x00, (sizeof(rfalNfcvListenDevice)*devLimit) );
     
-    /* NFC Forum device SHALL wait at least FDTVpp to consider the SLPV acknowledged (FDTVpp = FDTVpoll)  Digital 2.0 (Candidate)  9.7  9.8.2  */
-    ret = rfalTransceiveBlockingTxRx( (uint8_t*)&slpReq, sizeof(rfalNfcvSlpvReq), &rxBuf, sizeof(rxBuf), NULL, RFAL_TXRX_FLAGS_DEFAULT, RFAL_FDT_POLL_NFCV_POLLER, mspiChannel, mST25, gpio_cs, IRQ, fieldLED_01, fieldLED_02, fieldLED_03, fieldLED_04, fieldLED_05, fieldLED_06 ) ;
-    if( ret != ERR_TIMEOUT )
+    EXIT_ON_ERR( ret, rfalNfcvPollerInventoryStart( &it, stack, RFAL_NFCV_ADAPT_MAX_NODES, popHint, earlyStop ) );
+    
+    /* Retrieve devices until all masks are resolved or device limit is reached */
+    do
+    {
+        ret = rfalNfcvPollerInventoryNext( &it, &nfcvDevList[(*devCnt)], mspiChannel, mST25, gpio_cs, IRQ, fieldLED_01, fieldLED_02, fieldLED_03, fieldLED_04, fieldLED_05, fieldLED_06 );
+        if( ret == ERR_NONE )
+        {
+            (*devCnt)++;
+        }
+    }
+    while( (ret == ERR_NONE) && (*devCnt < devLimit) );
+    
+    /* Check for optional output parameter */
+    if( slotCnt != NULL )
+    {
+        *slotCnt = it.slots;
+    }
+    
+    return ((ret == ERR_RF_COLLISION) ? ERR_RF_COLLISION : ERR_NONE);
+}
+
+/*******************************************************************************/
+ReturnCode rfalNfcvPollerInventoryStart( rfalNfcvInventoryIt *it, rfalNfcvCollision *stack, uint16_t stackLen, uint16_t popHint, bool earlyStop )
+{
+    uint8_t i;
+    
+    if( (it == NULL) || (stack == NULL) || (stackLen < RFAL_NFCV_COLL_STACK_LEN_MIN) )
+    {
+        return ERR_PARAM;
+    }
+    
+    ST_MEMSET( it, 0x00, sizeof(rfalNfcvInventoryIt) );
+    it->stack     = stack;
+    it->stackLen  = stackLen;
+    it->earlyStop = earlyStop;
+    
+    /*******************************************************************************/
+    /* Match the initial mask depth to the expected population, skipping the level */
+    /* where every slot would collide                                              */
+    if( (popHint > (RFAL_NFCV_MAX_SLOTS * RFAL_NFCV_ADAPT_COLL_EST)) && (stackLen >= RFAL_NFCV_MAX_SLOTS) )
+    {
+        for( i = 0; i < RFAL_NFCV_MAX_SLOTS; i++ )
+        {
+            ST_MEMSET( &it->stack[it->stackCnt], 0x00, sizeof(rfalNfcvCollision) );
+            it->stack[it->stackCnt].maskLen    = RFAL_NFCV_SLOT_BITS;
+            it->stack[it->stackCnt].maskVal[0] = i;
+            it->stack[it->stackCnt].popEst     = (popHint / RFAL_NFCV_MAX_SLOTS);
+            it->stackCnt++;
+        }
+    }
+    else
+    {
+        ST_MEMSET( &it->stack[it->stackCnt], 0x00, sizeof(rfalNfcvCollision) );
+        it->stack[it->stackCnt].popEst = popHint;
+        it->stackCnt++;
+    }
+    
+    return ERR_NONE;
+}
+
+/*******************************************************************************/
+ReturnCode rfalNfcvPollerInventoryNext( rfalNfcvInventoryIt *it, rfalNfcvListenDevice *nfcvDev, SPI* mspiChannel, ST25R3911* mST25, DigitalOut* gpio_cs, InterruptIn* IRQ, DigitalOut* fieldLED_01, DigitalOut* fieldLED_02, DigitalOut* fieldLED_03, DigitalOut* fieldLED_04, DigitalOut* fieldLED_05, DigitalOut* fieldLED_06 )
+{
+    ReturnCode ret;
+    uint16_t   rcvdLen;
+    uint8_t    slotMask[RFAL_NFCV_UID_LEN];
+    uint8_t    i;
+    
+    if( (it == NULL) || (nfcvDev == NULL) || (it->stack == NULL) )
+    {
+        return ERR_PARAM;
+    }
+    
+    ST_MEMSET( nfcvDev, 0x00, sizeof(rfalNfcvListenDevice) );
+    
+    while( true )
+    {
+        /*******************************************************************************/
+        /* Continue an ongoing 16 slots round on its following slot                    */
+        if( it->isRoundOngoing )
+        {
+            /* End the round once all slots are done, or when the estimate is already accounted for */
+            if( (++it->slotNum >= RFAL_NFCV_MAX_SLOTS) || (it->earlyStop && (it->accounted >= it->cur.popEst)) )
+            {
+                rfalNfcvAdaptEndRound( it );
+                continue;
+            }
+            
+            platformDelay(RFAL_NFCV_FDT_EOF); /* Fulfil FDT EOF */
+            ret = rfalISO15693TransceiveAnticollisionEOF( (uint8_t*)&nfcvDev->InvRes, sizeof(rfalNfcvInventoryRes), &rcvdLen, mspiChannel, mST25, gpio_cs, IRQ, fieldLED_01, fieldLED_02, fieldLED_03, fieldLED_04, fieldLED_05, fieldLED_06 ) ;
+            it->slots++;
+        }
+        /*******************************************************************************/
+        /* Resolve the next pending mask                                               */
+        else
+        {
+            if( it->stackCnt == 0 )
+            {
+                return (it->dropped ? ERR_RF_COLLISION : ERR_TIMEOUT);
+            }
+            
+            it->cur = it->stack[--it->stackCnt];
+            
+            /* Few devices expected: a single slot probe, split at the collision bit */
+            if( (it->cur.popEst <= RFAL_NFCV_ADAPT_1SLOT_MAX) || (it->cur.maskLen > RFAL_NFCV_MASKVAL_MAX_16SLOT_LEN) )
+            {
+                ret = rfalNfcvPollerInventory( RFAL_NFCV_NUM_SLOTS_1, it->cur.maskLen, it->cur.maskVal, &nfcvDev->InvRes, &rcvdLen, mspiChannel, mST25, gpio_cs, IRQ, fieldLED_01, fieldLED_02, fieldLED_03, fieldLED_04, fieldLED_05, fieldLED_06 ) ;
+                it->slots++;
+                
+                if( ret == ERR_NONE )
+                {
+                    it->devCnt++;
+                    return ERR_NONE;
+                }
+                
+                if( ret == ERR_RF_COLLISION )
+                {
+                    /* At least two devices on the mask. Without any estimate yet, measure it with a 16 slots round */
+                    rfalNfcvAdaptPushCollision( it, it->cur.maskVal, it->cur.maskLen, nfcvDev->InvRes.UID, rcvdLen, ((it->cur.popEst == 0) ? (RFAL_NFCV_ADAPT_1SLOT_MAX + 1) : MAX( it->cur.popEst, RFAL_NFCV_ADAPT_COLL_EST )) );
+                }
+                continue;
+            }
+            
+            /* Many devices expected: start a 16 slots round on the mask */
+            ret = rfalNfcvPollerInventory( RFAL_NFCV_NUM_SLOTS_16, it->cur.maskLen, it->cur.maskVal, &nfcvDev->InvRes, &rcvdLen, mspiChannel, mST25, gpio_cs, IRQ, fieldLED_01, fieldLED_02, fieldLED_03, fieldLED_04, fieldLED_05, fieldLED_06 ) ;
+            it->slots++;
+            
+            it->slotNum        = 0;
+            it->accounted      = 0;
+            it->roundEmpty     = 0;
+            it->roundSingle    = 0;
+            it->roundColl      = 0;
+            it->roundBase      = it->stackCnt;
+            it->isRoundOngoing = true;
+        }
+        
+        /*******************************************************************************/
+        /* Handle the response on the current slot                                     */
+        if( (ret == ERR_NONE) && (rcvdLen == rfalConvBytesToBits(RFAL_NFCV_INV_RES_LEN + RFAL_NFCV_CRC_LEN)) )
+        {
+            it->roundSingle++;
+            it->accounted++;
+            it->devCnt++;
+            return ERR_NONE;
+        }
+        
+        if( ret == ERR_RF_COLLISION )
+        {
+            /* Devices on the same slot share the mask plus the slot number as the following UID bits */
+            ST_MEMCPY( slotMask, it->cur.maskVal, RFAL_NFCV_UID_LEN );
+            for( i = 0; i < RFAL_NFCV_SLOT_BITS; i++ )
+            {
+                slotMask[((it->cur.maskLen + i) / 8)] &= (uint8_t)~(1U << ((it->cur.maskLen + i) % 8));
+                slotMask[((it->cur.maskLen + i) / 8)] |= (uint8_t)(((it->slotNum >> i) & 0x01) << ((it->cur.maskLen + i) % 8));
+            }
+            
+            /* Estimate set once the round ends */
+            rfalNfcvAdaptPushCollision( it, slotMask, (it->cur.maskLen + RFAL_NFCV_SLOT_BITS), nfcvDev->InvRes.UID, rcvdLen, (RFAL_NFCV_ADAPT_1SLOT_MAX + 1) );
+            it->roundColl++;
+            it->accounted += RFAL_NFCV_ADAPT_COLL_EST;
+        }
+        else
+        {
+            it->roundEmpty++;
+        }
+        
+        ST_MEMSET( nfcvDev, 0x00, sizeof(rfalNfcvListenDevice) );
+    }
+}
+
+/*******************************************************************************/
+ReturnCode rfalNfvPollerSleep( uint8_t flags, uint8_t* uid, SPI* mspiChannel, ST25R3911* mST25, DigitalOut* gpio_cs, InterruptIn* IRQ, DigitalOut* fieldLED_01, DigitalOut* fieldLED_02, DigitalOut* fieldLED_03, DigitalOut* fieldLED_04, DigitalOut* fieldLED_05, DigitalOut* fieldLED_06 )
+{
+    ReturnCode      ret;
+    rfalNfcvSlpvReq slpReq;
+    uint8_t         rxBuf;    /* dummy buffer, just to perform Rx */
+    
+    if( uid == NULL )
+    {
+        return ERR_PARAM;
+    }
+    
+    /* Compute SLPV_REQ */
+    slpReq.REQ_FLAG = (flags | RFAL_NFCV_REQ_FLAG_ADDRESS);   /* Should be with UID according Digital 2.0 (Candidate) 9.7.1.1 */
+    slpReq.CMD      = RFAL_NFCF_CMD_SLPV;
+    ST_MEMCPY( slpReq.UID, uid, RFAL_NFCV_UID_LEN );
+    
+    /* NFC Forum device SHALL wait at least FDTVpp to consider the SLPV acknowledged (FDTVpp = FDTVpoll)  Digital 2.0 (Candidate)  9.7  9.8.2  */
+    ret = rfalTransceiveBlockingTxRx( (uint8_t*)&slpReq, sizeof(rfalNfcvSlpvReq), &rxBuf, sizeof(rxBuf), NULL, RFAL_TXRX_FLAGS_DEFAULT, RFAL_FDT_POLL_NFCV_POLLER, mspiChannel, mST25, gpio_cs, IRQ, fieldLED_01, fieldLED_02, fieldLED_03, fieldLED_04, fieldLED_05, fieldLED_06 ) ;
+    if( ret != ERR_TIMEOUT )
     {
         return ret;
     }
@@ -458,112 +1106,218 @@ ReturnCode rfalNfvSelect( uint8_t flags, uint8_t* uid, SPI* mspiChannel, ST25R39
 }
 
 /*******************************************************************************/
-ReturnCode rfalNfvReadSingleBlock( uint8_t flags, uint8_t* uid, uint8_t blockNum, uint8_t* rxBuf, uint16_t rxBufLen, uint16_t *rcvLen, SPI* mspiChannel, ST25R3911* mST25, DigitalOut* gpio_cs, InterruptIn* IRQ, DigitalOut* fieldLED_01, DigitalOut* fieldLED_02, DigitalOut* fieldLED_03, DigitalOut* fieldLED_04, DigitalOut* fieldLED_05, DigitalOut* fieldLED_06 )
+ReturnCode rfalNfvResetToReady( uint8_t flags, uint8_t* uid, SPI* mspiChannel, ST25R3911* mST25, DigitalOut* gpio_cs, InterruptIn* IRQ, DigitalOut* fieldLED_01, DigitalOut* fieldLED_02, DigitalOut* fieldLED_03, DigitalOut* fieldLED_04, DigitalOut* fieldLED_05, DigitalOut* fieldLED_06 )
 {
+    uint16_t           rcvLen;
     ReturnCode         ret;
     rfalNfcvGenericReq req;
-    rfalNfcvGenericRes *res;
+    rfalNfcvGenericRes res;
     uint8_t            msgIt;
     
     msgIt = 0;
-    res   = (rfalNfcvGenericRes*)rxBuf;
     
     /* Compute Request Command */
-    req.REQ_FLAG  = (flags & (~RFAL_NFCV_REQ_FLAG_ADDRESS & ~RFAL_NFCV_REQ_FLAG_SELECT));
-    req.CMD       = RFAL_NFCF_CMD_READ_SINGLE_BLOCK;
+    req.REQ_FLAG = (flags & ~RFAL_NFCV_REQ_FLAG_ADDRESS);
+    req.CMD      = RFAL_NFCF_CMD_RESET_TO_READY;
     
-    /* Check if request is to be sent in Addressed or Selected mode */
-    if( uid != NULL )
-    {
-        req.REQ_FLAG |= RFAL_NFCV_REQ_FLAG_ADDRESS;
-        ST_MEMCPY( req.payload.UID, uid, RFAL_NFCV_UID_LEN );
-        msgIt += RFAL_NFCV_UID_LEN;
-        req.payload.data[ (RFAL_NFCV_UID_LEN + msgIt++) ] = blockNum;
-    }
-    else
+    /* Without UID all devices in the field reset, their responses are not checked */
+    if( uid == NULL )
     {
-        req.REQ_FLAG |= RFAL_NFCV_REQ_FLAG_SELECT;
-        req.payload.data[msgIt++] = blockNum;
+        ret = rfalTransceiveBlockingTxRx( (uint8_t*)&req, (RFAL_CMD_LEN + RFAL_NFCV_FLAG_LEN), (uint8_t*)&res, sizeof(rfalNfcvGenericRes), &rcvLen, RFAL_TXRX_FLAGS_DEFAULT, RFAL_FDT_POLL_MAX, mspiChannel, mST25, gpio_cs, IRQ, fieldLED_01, fieldLED_02, fieldLED_03, fieldLED_04, fieldLED_05, fieldLED_06 ) ;
+        if( (ret == ERR_TIMEOUT) || (ret == ERR_RF_COLLISION) || (ret == ERR_CRC) || (ret == ERR_FRAMING) )
+        {
+            return ERR_NONE;
+        }
+        return ret;
     }
     
-    /* Transceive Command */
-    ret = rfalTransceiveBlockingTxRx( (uint8_t*)&req, (RFAL_CMD_LEN + RFAL_NFCV_FLAG_LEN + msgIt), rxBuf, rxBufLen, rcvLen, RFAL_TXRX_FLAGS_DEFAULT, RFAL_FDT_POLL_MAX, mspiChannel, mST25, gpio_cs, IRQ, fieldLED_01, fieldLED_02, fieldLED_03, fieldLED_04, fieldLED_05, fieldLED_06 ) ;
+    req.REQ_FLAG |= RFAL_NFCV_REQ_FLAG_ADDRESS;
+    ST_MEMCPY( req.payload.UID, uid, RFAL_NFCV_UID_LEN );
+    msgIt += RFAL_NFCV_UID_LEN;
+    
+    ret = rfalTransceiveBlockingTxRx( (uint8_t*)&req, (RFAL_CMD_LEN + RFAL_NFCV_FLAG_LEN + msgIt), (uint8_t*)&res, sizeof(rfalNfcvGenericRes), &rcvLen, RFAL_TXRX_FLAGS_DEFAULT, RFAL_FDT_POLL_MAX, mspiChannel, mST25, gpio_cs, IRQ, fieldLED_01, fieldLED_02, fieldLED_03, fieldLED_04, fieldLED_05, fieldLED_06 ) ;
     if( ret != ERR_NONE )
     {
         return ret;
     }
     
     /* Check if the response minimum length has been received */
-    if( (*rcvLen) < RFAL_NFCV_FLAG_LEN )
+    if( rcvLen < RFAL_NFCV_FLAG_LEN )
     {
         return ERR_PROTO;
     }
     
     /* Check if an error has been signalled */
-    if( res->RES_FLAG & RFAL_NFCV_RES_FLAG_ERROR )
+    if( res.RES_FLAG & RFAL_NFCV_RES_FLAG_ERROR )
     {
-        return rfalNfvParseError( *(res->data) );
+        return rfalNfvParseError( *res.data );
     }
     
     return ERR_NONE;
 }
 
+/*******************************************************************************/
+ReturnCode rfalNfvReadSingleBlock( uint8_t flags, uint8_t* uid, uint8_t blockNum, uint8_t* rxBuf, uint16_t rxBufLen, uint16_t *rcvLen, SPI* mspiChannel, ST25R3911* mST25, DigitalOut* gpio_cs, InterruptIn* IRQ, DigitalOut* fieldLED_01, DigitalOut* fieldLED_02, DigitalOut* fieldLED_03, DigitalOut* fieldLED_04, DigitalOut* fieldLED_05, DigitalOut* fieldLED_06 )
+{
+    return rfalNfvReadBlocks( flags, uid, RFAL_NFCF_CMD_READ_SINGLE_BLOCK, RFAL_NFCV_CMD_FAST_READ_SINGLE_BLOCK, &blockNum, sizeof(uint8_t), rxBuf, rxBufLen, rcvLen, mspiChannel, mST25, gpio_cs, IRQ, fieldLED_01, fieldLED_02, fieldLED_03, fieldLED_04, fieldLED_05, fieldLED_06 );
+}
+
 /*******************************************************************************/
 ReturnCode rfalNfvWriteSingleBlock( uint8_t flags, uint8_t* uid, uint8_t blockNum, uint8_t* wrData, uint8_t blockLen, SPI* mspiChannel, ST25R3911* mST25, DigitalOut* gpio_cs, InterruptIn* IRQ, DigitalOut* fieldLED_01, DigitalOut* fieldLED_02, DigitalOut* fieldLED_03, DigitalOut* fieldLED_04, DigitalOut* fieldLED_05, DigitalOut* fieldLED_06 )
 {
-    ReturnCode         ret;
-    uint16_t           rcvLen;
-    rfalNfcvGenericReq req;
-    rfalNfcvGenericRes res;
-    uint8_t            msgIt;
+    return rfalNfvWriteMultipleBlocks( flags, uid, blockNum, 1, wrData, blockLen, mspiChannel, mST25, gpio_cs, IRQ, fieldLED_01, fieldLED_02, fieldLED_03, fieldLED_04, fieldLED_05, fieldLED_06 );
+}
+
+/*******************************************************************************/
+ReturnCode rfalNfvWriteMultipleBlocks( uint8_t flags, uint8_t* uid, uint16_t firstBlockNum, uint8_t numOfBlocks, const uint8_t* wrData, uint8_t blockLen, SPI* mspiChannel, ST25R3911* mST25, DigitalOut* gpio_cs, InterruptIn* IRQ, DigitalOut* fieldLED_01, DigitalOut* fieldLED_02, DigitalOut* fieldLED_03, DigitalOut* fieldLED_04, DigitalOut* fieldLED_05, DigitalOut* fieldLED_06 )
+{
+    /* Extended commands are needed as soon as the last block is above 255 */
+    return rfalNfvWriteBlocks( flags, uid, firstBlockNum, numOfBlocks, wrData, blockLen, (((uint32_t)firstBlockNum + numOfBlocks - 1) > UINT8_MAX), mspiChannel, mST25, gpio_cs, IRQ, fieldLED_01, fieldLED_02, fieldLED_03, fieldLED_04, fieldLED_05, fieldLED_06 );
+}
 
-    if( blockLen > RFAL_NFCV_MAX_BLOCK_LEN )
+/*******************************************************************************/
+static ReturnCode rfalNfvWriteBlocks( uint8_t flags, uint8_t* uid, uint16_t firstBlockNum, uint8_t numOfBlocks, const uint8_t* wrData, uint8_t blockLen, bool isExt, SPI* mspiChannel, ST25R3911* mST25, DigitalOut* gpio_cs, InterruptIn* IRQ, DigitalOut* fieldLED_01, DigitalOut* fieldLED_02, DigitalOut* fieldLED_03, DigitalOut* fieldLED_04, DigitalOut* fieldLED_05, DigitalOut* fieldLED_06 )
+{
+    rfalNfcvGenericReq req;
+    uint8_t            param[RFAL_NFCV_WRITE_MAX_DATA_LEN + 4];
+    uint8_t            paramLen;
+    uint8_t            cmd;
+    uint16_t           dataLen;
+    
+    dataLen = ((uint16_t)numOfBlocks * blockLen);
+    
+    if( (wrData == NULL) || (numOfBlocks == 0) || (blockLen == 0) || (blockLen > RFAL_NFCV_MAX_BLOCK_LEN) || (dataLen > RFAL_NFCV_WRITE_MAX_DATA_LEN) )
     {
         return ERR_PARAM;
     }
     
-    msgIt = 0;
-    
-    /* Compute Request Command */
-    req.REQ_FLAG  = (flags & (~RFAL_NFCV_REQ_FLAG_ADDRESS & ~RFAL_NFCV_REQ_FLAG_SELECT));
-    req.CMD       = RFAL_NFCF_CMD_WRITE_SINGLE_BLOCK;
-    
-    /* Check if request is to be sent in Addressed or Selected mode */
-    if( uid != NULL )
+    /*******************************************************************************/
+    /* Single block uses Write Single Block, the number of blocks is encoded minus one */
+    paramLen = 0;
+    if( isExt )
     {
-        req.REQ_FLAG |= RFAL_NFCV_REQ_FLAG_ADDRESS;
-        ST_MEMCPY( req.payload.UID, uid, RFAL_NFCV_UID_LEN );
-        msgIt += RFAL_NFCV_UID_LEN;
-        req.payload.data[msgIt++] = blockNum;
-        ST_MEMCPY( &req.payload.data[msgIt], wrData, blockLen );
-        msgIt += blockLen;
+        param[paramLen++] = (uint8_t)(firstBlockNum & 0xFF);
+        param[paramLen++] = (uint8_t)(firstBlockNum >> 8);
+        if( numOfBlocks > 1 )
+        {
+            param[paramLen++] = (uint8_t)(numOfBlocks - 1);
+            param[paramLen++] = 0x00;
+        }
+        cmd = ((numOfBlocks > 1) ? RFAL_NFCF_CMD_EXTENDED_WRITE_MULTIPLE_BLOCKS : RFAL_NFCF_CMD_EXTENDED_WRITE_SINGLE_BLOCK);
     }
     else
     {
-        req.REQ_FLAG |= RFAL_NFCV_REQ_FLAG_SELECT;
-        req.payload.data[msgIt++] = blockNum;
-        ST_MEMCPY( &req.payload.data[msgIt], wrData, blockLen );
-        msgIt += blockLen;
+        param[paramLen++] = (uint8_t)firstBlockNum;
+        if( numOfBlocks > 1 )
+        {
+            param[paramLen++] = (uint8_t)(numOfBlocks - 1);
+        }
+        cmd = ((numOfBlocks > 1) ? RFAL_NFCF_CMD_WRITE_MULTIPLE_BLOCKS : RFAL_NFCF_CMD_WRITE_SINGLE_BLOCK);
     }
     
-    /* Transceive Command */
-    ret = rfalTransceiveBlockingTxRx( (uint8_t*)&req, (RFAL_CMD_LEN + RFAL_NFCV_FLAG_LEN + msgIt), (uint8_t*)&res, sizeof(rfalNfcvGenericRes), &rcvLen, RFAL_TXRX_FLAGS_DEFAULT, RFAL_FDT_POLL_MAX, mspiChannel, mST25, gpio_cs, IRQ, fieldLED_01, fieldLED_02, fieldLED_03, fieldLED_04, fieldLED_05, fieldLED_06 ) ;
+    ST_MEMCPY( &param[paramLen], wrData, dataLen );
+    paramLen += dataLen;
     
-    if( ret != ERR_NONE )
+    return rfalNfvWriteTransceive( &req, rfalNfvComputeReq( &req, flags, cmd, false, uid, param, paramLen ), (RFAL_NFCV_WRITE_TIME_MS + ((numOfBlocks - 1) * RFAL_NFCV_WRITE_TIME_BLOCK_MS)), mspiChannel, mST25, gpio_cs, IRQ, fieldLED_01, fieldLED_02, fieldLED_03, fieldLED_04, fieldLED_05, fieldLED_06 );
+}
+
+/*******************************************************************************/
+ReturnCode rfalNfcvPollerWriteMemory( const rfalNfcvMemWriteParam *param, SPI* mspiChannel, ST25R3911* mST25, DigitalOut* gpio_cs, InterruptIn* IRQ, DigitalOut* fieldLED_01, DigitalOut* fieldLED_02, DigitalOut* fieldLED_03, DigitalOut* fieldLED_04, DigitalOut* fieldLED_05, DigitalOut* fieldLED_06 )
+{
+    ReturnCode         ret;
+    rfalNfcvGenericReq req;
+    uint8_t            rxBuf[RFAL_NFCV_READ_BUF_LEN];
+    uint8_t            blkBuf[RFAL_NFCV_FLAG_LEN + RFAL_NFCV_MAX_BLOCK_LEN + RFAL_NFCV_CRC_LEN];
+    uint16_t           rcvLen;
+    uint16_t           blkLen;
+    uint16_t           block;
+    uint16_t           lastBlock;
+    uint16_t           chunk;
+    uint16_t           maxBlocks;
+    uint16_t           i;
+    uint8_t            retries;
+    uint8_t            reqLen;
+    bool               isExt;
+    bool               isDiff;
+    
+    if( (param == NULL) || (param->data == NULL) || (param->numBlocks == 0) || (param->blockLen == 0) || (param->blockLen > RFAL_NFCV_MAX_BLOCK_LEN) ||
+        (((uint32_t)param->firstBlock + param->numBlocks) > (UINT16_MAX + 1UL)) )
     {
-        return ret;
+        return ERR_PARAM;
     }
     
-    /* Check if the response minimum length has been received */
-    if( rcvLen < RFAL_NFCV_FLAG_LEN )
+    /* The addressing mode is chosen once for the whole range, writes and read back alike */
+    lastBlock = (param->firstBlock + param->numBlocks - 1);
+    isExt     = (lastBlock > UINT8_MAX);
+    maxBlocks = MAX( MIN( param->maxBlocksPerWrite, (RFAL_NFCV_WRITE_MAX_DATA_LEN / param->blockLen) ), 1 );
+    
+    /*******************************************************************************/
+    /* Write all chunks                                                            */
+    for( block = param->firstBlock; ; block += chunk )
     {
-        return ERR_PROTO;
+        chunk = MIN( maxBlocks, (lastBlock - block + 1) );
+        EXIT_ON_ERR( ret, rfalNfvWriteBlocks( param->flags, param->uid, block, (uint8_t)chunk, &param->data[(uint32_t)(block - param->firstBlock) * param->blockLen], param->blockLen, isExt, mspiChannel, mST25, gpio_cs, IRQ, fieldLED_01, fieldLED_02, fieldLED_03, fieldLED_04, fieldLED_05, fieldLED_06 ) );
+        
+        if( (block + chunk - 1) >= lastBlock )
+        {
+            break;
+        }
     }
     
-    /* Check if an error has been signalled */
-    if( res.RES_FLAG & RFAL_NFCV_RES_FLAG_ERROR )
+    if( !param->verify )
     {
-        return rfalNfvParseError( *res.data );
+        return ERR_NONE;
+    }
+    
+    /*******************************************************************************/
+    /* Read back the whole range, rewriting only the blocks that differ            */
+    maxBlocks = (RFAL_NFCV_READ_MAX_DATA_LEN / param->blockLen);
+    
+    for( block = param->firstBlock; ; block += chunk )
+    {
+        chunk = MIN( maxBlocks, (lastBlock - block + 1) );
+        
+        /* Security status is not requested on read back */
+        reqLen = rfalNfvComputeReadReq( &req, (param->flags & ~RFAL_NFCV_REQ_FLAG_OPTION), param->uid, block, chunk, isExt, false );
+        EXIT_ON_ERR( ret, rfalTransceiveBlockingTxRx( (uint8_t*)&req, reqLen, rxBuf, sizeof(rxBuf), &rcvLen, RFAL_TXRX_FLAGS_DEFAULT, RFAL_FDT_POLL_MAX, mspiChannel, mST25, gpio_cs, IRQ, fieldLED_01, fieldLED_02, fieldLED_03, fieldLED_04, fieldLED_05, fieldLED_06 ) );
+        
+        if( (rcvLen < RFAL_NFCV_FLAG_LEN) || (rxBuf[0] & RFAL_NFCV_RES_FLAG_ERROR) )
+        {
+            return ((rcvLen < RFAL_NFCV_FLAG_LEN) ? ERR_PROTO : rfalNfvParseError( rxBuf[RFAL_NFCV_FLAG_LEN] ));
+        }
+        
+        if( rcvLen != (RFAL_NFCV_FLAG_LEN + (chunk * param->blockLen)) )
+        {
+            return ERR_PROTO;
+        }
+        
+        for( i = 0; i < chunk; i++ )
+        {
+            const uint8_t *exp = &param->data[(uint32_t)(block + i - param->firstBlock) * param->blockLen];
+            
+            isDiff = (ST_BYTECMP( &rxBuf[RFAL_NFCV_FLAG_LEN + (i * param->blockLen)], exp, param->blockLen ) != 0);
+            
+            /* Rewrite the block and check it on its own */
+            for( retries = 0; isDiff; retries++ )
+            {
+                if( retries >= param->retries )
+                {
+                    return ERR_WRITE;
+                }
+                
+                EXIT_ON_ERR( ret, rfalNfvWriteBlocks( param->flags, param->uid, (block + i), 1, exp, param->blockLen, isExt, mspiChannel, mST25, gpio_cs, IRQ, fieldLED_01, fieldLED_02, fieldLED_03, fieldLED_04, fieldLED_05, fieldLED_06 ) );
+                
+                reqLen = rfalNfvComputeReadReq( &req, (param->flags & ~RFAL_NFCV_REQ_FLAG_OPTION), param->uid, (block + i), 1, isExt, false );
+                EXIT_ON_ERR( ret, rfalTransceiveBlockingTxRx( (uint8_t*)&req, reqLen, blkBuf, sizeof(blkBuf), &blkLen, RFAL_TXRX_FLAGS_DEFAULT, RFAL_FDT_POLL_MAX, mspiChannel, mST25, gpio_cs, IRQ, fieldLED_01, fieldLED_02, fieldLED_03, fieldLED_04, fieldLED_05, fieldLED_06 ) );
+                
+                isDiff = ( (blkLen != (RFAL_NFCV_FLAG_LEN + param->blockLen)) || (blkBuf[0] & RFAL_NFCV_RES_FLAG_ERROR) || (ST_BYTECMP( &blkBuf[RFAL_NFCV_FLAG_LEN], exp, param->blockLen ) != 0) );
+            }
+        }
+        
+        if( (block + chunk - 1) >= lastBlock )
+        {
+            break;
+        }
     }
     
     return ERR_NONE;
@@ -572,54 +1326,777 @@ ReturnCode rfalNfvWriteSingleBlock( uint8_t flags, uint8_t* uid, uint8_t blockNu
 /*******************************************************************************/
 ReturnCode rfalNfvReadMultipleBlocks( uint8_t flags, uint8_t* uid, uint8_t firstBlockNum, uint8_t numOfBlocks, uint8_t* rxBuf, uint16_t rxBufLen, uint16_t *rcvLen, SPI* mspiChannel, ST25R3911* mST25, DigitalOut* gpio_cs, InterruptIn* IRQ, DigitalOut* fieldLED_01, DigitalOut* fieldLED_02, DigitalOut* fieldLED_03, DigitalOut* fieldLED_04, DigitalOut* fieldLED_05, DigitalOut* fieldLED_06 )
 {
-    ReturnCode          ret;
-    rfalNfcvGenericReq  req;
-    rfalNfcvGenericRes  *res;
-    uint8_t             msgIt;
+    uint8_t param[2];
     
-    msgIt = 0;
-    res   = (rfalNfcvGenericRes*)rxBuf;
-    
-    /* Compute Request Command */
-    req.REQ_FLAG  = (flags & (~RFAL_NFCV_REQ_FLAG_ADDRESS & ~RFAL_NFCV_REQ_FLAG_SELECT));
-    req.CMD       = RFAL_NFCF_CMD_READ_MULTIPLE_BLOCKS;
+    param[0] = firstBlockNum;
+    param[1] = numOfBlocks;
     
-    /* Check if request is to be sent in Addressed or Selected mode */
-    if( uid != NULL )
-    {
-        req.REQ_FLAG |= RFAL_NFCV_REQ_FLAG_ADDRESS;
-        ST_MEMCPY( req.payload.UID, uid, RFAL_NFCV_UID_LEN );
-        msgIt += RFAL_NFCV_UID_LEN;
-        req.payload.data[ (RFAL_NFCV_UID_LEN + msgIt++) ] = firstBlockNum;
-        req.payload.data[ (RFAL_NFCV_UID_LEN + msgIt++) ] = numOfBlocks;
-    }
-    else
-    {
-        req.REQ_FLAG |= RFAL_NFCV_REQ_FLAG_SELECT;
-        req.payload.data[msgIt++] = firstBlockNum;
-        req.payload.data[msgIt++] = numOfBlocks;
-    }
+    return rfalNfvReadBlocks( flags, uid, RFAL_NFCF_CMD_READ_MULTIPLE_BLOCKS, RFAL_NFCV_CMD_FAST_READ_MULTIPLE_BLOCKS, param, sizeof(param), rxBuf, rxBufLen, rcvLen, mspiChannel, mST25, gpio_cs, IRQ, fieldLED_01, fieldLED_02, fieldLED_03, fieldLED_04, fieldLED_05, fieldLED_06 );
+}
+
+/*******************************************************************************/
+ReturnCode rfalNfvGetSystemInformation( uint8_t flags, uint8_t* uid, rfalNfcvSystemInfo *sysInfo, SPI* mspiChannel, ST25R3911* mST25, DigitalOut* gpio_cs, InterruptIn* IRQ, DigitalOut* fieldLED_01, DigitalOut* fieldLED_02, DigitalOut* fieldLED_03, DigitalOut* fieldLED_04, DigitalOut* fieldLED_05, DigitalOut* fieldLED_06 )
+{
+    ReturnCode         ret;
+    rfalNfcvGenericReq req;
+    rfalNfcvGenericRes res;
+    uint16_t           rcvLen;
+    uint8_t            reqLen;
+    uint8_t            msgIt;
+    uint8_t            param;
+    bool               isExt;
+    rfalNfcvSystemInfo info;
     
-    /* Transceive Command */
-    ret = rfalTransceiveBlockingTxRx( (uint8_t*)&req, (RFAL_CMD_LEN + RFAL_NFCV_FLAG_LEN + msgIt), rxBuf, rxBufLen, rcvLen, RFAL_TXRX_FLAGS_DEFAULT, RFAL_FDT_POLL_MAX, mspiChannel, mST25, gpio_cs, IRQ, fieldLED_01, fieldLED_02, fieldLED_03, fieldLED_04, fieldLED_05, fieldLED_06 ) ;
-    if( ret != ERR_NONE )
+    if( sysInfo == NULL )
     {
-        return ret;
+        return ERR_PARAM;
     }
     
-    /* Check if the response minimum length has been received */
-    if( (*rcvLen) < RFAL_NFCV_FLAG_LEN )
-    {
-        return ERR_PROTO;
-    }
+    isExt = false;
     
-    /* Check if an error has been signalled */
-    if( res->RES_FLAG & RFAL_NFCV_RES_FLAG_ERROR )
+    do
     {
-        return rfalNfvParseError( *(res->data) );
-    }
-    
-    return ERR_NONE;
+        /*******************************************************************************/
+        /* Extended request carries the parameter request field before the UID         */
+        if( isExt )
+        {
+            param  = RFAL_NFCV_SYSINFO_REQ_FIELD;
+            reqLen = rfalNfvComputeReq( &req, flags, RFAL_NFCF_CMD_EXTENDED_GET_SYS_INFO, false, NULL, NULL, 0 );
+            
+            req.payload.data[0] = param;
+            if( uid != NULL )
+            {
+                req.REQ_FLAG = ((req.REQ_FLAG & ~RFAL_NFCV_REQ_FLAG_SELECT) | RFAL_NFCV_REQ_FLAG_ADDRESS);
+                ST_MEMCPY( &req.payload.data[sizeof(uint8_t)], uid, RFAL_NFCV_UID_LEN );
+                reqLen += RFAL_NFCV_UID_LEN;
+            }
+            reqLen += sizeof(uint8_t);
+        }
+        else
+        {
+            reqLen = rfalNfvComputeReq( &req, flags, RFAL_NFCF_CMD_GET_SYS_INFO, false, uid, NULL, 0 );
+        }
+        
+        ret = rfalTransceiveBlockingTxRx( (uint8_t*)&req, reqLen, (uint8_t*)&res, sizeof(rfalNfcvGenericRes), &rcvLen, RFAL_TXRX_FLAGS_DEFAULT, RFAL_FDT_POLL_MAX, mspiChannel, mST25, gpio_cs, IRQ, fieldLED_01, fieldLED_02, fieldLED_03, fieldLED_04, fieldLED_05, fieldLED_06 ) ;
+        
+        /* An extended request not supported keeps the standard information */
+        if( isExt && ((ret != ERR_NONE) || (rcvLen < RFAL_NFCV_FLAG_LEN) || (res.RES_FLAG & RFAL_NFCV_RES_FLAG_ERROR)) )
+        {
+            return ERR_NONE;
+        }
+        
+        if( ret != ERR_NONE )
+        {
+            return ret;
+        }
+        
+        /* Check if the response minimum length has been received */
+        if( rcvLen < RFAL_NFCV_FLAG_LEN )
+        {
+            return ERR_PROTO;
+        }
+        
+        /* Check if an error has been signalled */
+        if( res.RES_FLAG & RFAL_NFCV_RES_FLAG_ERROR )
+        {
+            return rfalNfvParseError( *res.data );
+        }
+        
+        /*******************************************************************************/
+        /* Parse the information present, a malformed extended response keeps the     */
+        /* standard information already in sysInfo                                    */
+        rcvLen -= RFAL_NFCV_FLAG_LEN;
+        if( rcvLen < (sizeof(uint8_t) + RFAL_NFCV_UID_LEN) )
+        {
+            return (isExt ? ERR_NONE : ERR_PROTO);
+        }
+        
+        ST_MEMSET( &info, 0x00, sizeof(rfalNfcvSystemInfo) );
+        msgIt = 0;
+        info.infoFlags  = res.data[msgIt++];
+        info.isExtended = isExt;
+        ST_MEMCPY( info.uid, &res.data[msgIt], RFAL_NFCV_UID_LEN );
+        msgIt += RFAL_NFCV_UID_LEN;
+        
+        if( info.infoFlags & RFAL_NFCV_SYSINFO_DSFID )
+        {
+            info.dsfid = res.data[msgIt++];
+        }
+        if( info.infoFlags & RFAL_NFCV_SYSINFO_AFI )
+        {
+            info.afi = res.data[msgIt++];
+        }
+        if( info.infoFlags & RFAL_NFCV_SYSINFO_MEMSIZE )
+        {
+            if( isExt )
+            {
+                info.numBlocks = ((uint16_t)res.data[msgIt] | ((uint16_t)res.data[msgIt + 1] << 8)) + 1;
+                msgIt += sizeof(uint16_t);
+            }
+            else
+            {
+                info.numBlocks = ((uint16_t)res.data[msgIt++] + 1);
+            }
+            info.blockLen = ((res.data[msgIt++] & RFAL_NFCV_BLOCKLEN_MASK) + 1);
+        }
+        if( info.infoFlags & RFAL_NFCV_SYSINFO_ICREF )
+        {
+            info.icRef = res.data[msgIt++];
+        }
+        
+        if( msgIt > rcvLen )
+        {
+            return (isExt ? ERR_NONE : ERR_PROTO);
+        }
+        *sysInfo = info;
+        
+        /* A full standard memory size may be truncated, ask for the extended one */
+        isExt = (!isExt && ((info.numBlocks == 0) || (info.numBlocks == RFAL_NFCV_STD_MAX_BLOCKS)));
+    }
+    while( isExt );
+    
+    return ERR_NONE;
+}
+
+/*******************************************************************************/
+ReturnCode rfalNfcvPollerReadMemory( const rfalNfcvMemReadParam *param, rfalNfcvSystemInfo *sysInfo, uint32_t *rcvdLen, SPI* mspiChannel, ST25R3911* mST25, DigitalOut* gpio_cs, InterruptIn* IRQ, DigitalOut* fieldLED_01, DigitalOut* fieldLED_02, DigitalOut* fieldLED_03, DigitalOut* fieldLED_04, DigitalOut* fieldLED_05, DigitalOut* fieldLED_06 )
+{
+    ReturnCode            ret;
+    rfalNfcvSystemInfo    info;
+    rfalTransceiveContext ctx;
+    rfalNfcvGenericReq    req[2];
+    uint8_t               reqLen[2];
+    uint8_t               rxBuf[RFAL_NFCV_READ_BUF_LEN];
+    uint16_t              rxLen;
+    uint16_t              chunkFirst[2];
+    uint16_t              chunkBlocks[2];
+    uint16_t              lastBlock;
+    uint16_t              nextBlock;
+    uint16_t              maxBlocks;
+    uint32_t              offset;
+    uint8_t               entryLen;
+    uint8_t               retries;
+    uint8_t               cur;
+    bool                  isExt;
+    bool                  isFast;
+    bool                  isNextReady;
+    bool                  isAnyRead;
+    rfalBitRate           txBR;
+    rfalBitRate           rxBR;
+    
+    if( (param == NULL) || ((param->buf == NULL) && (param->cb == NULL)) )
+    {
+        return ERR_PARAM;
+    }
+    
+    if( rcvdLen != NULL )
+    {
+        *rcvdLen = 0;
+    }
+    
+    /*******************************************************************************/
+    /* Discover the memory layout                                                  */
+    EXIT_ON_ERR( ret, rfalNfvGetSystemInformation( param->flags, param->uid, &info, mspiChannel, mST25, gpio_cs, IRQ, fieldLED_01, fieldLED_02, fieldLED_03, fieldLED_04, fieldLED_05, fieldLED_06 ) );
+    if( sysInfo != NULL )
+    {
+        *sysInfo = info;
+    }
+    
+    if( (info.numBlocks == 0) || (info.blockLen == 0) )
+    {
+        return ERR_NOTSUPP;
+    }
+    
+    if( (param->firstBlock >= info.numBlocks) || ((param->numBlocks != 0) && (((uint32_t)param->firstBlock + param->numBlocks) > info.numBlocks)) )
+    {
+        return ERR_PARAM;
+    }
+    
+    lastBlock = ((param->numBlocks == 0) ? info.numBlocks : (param->firstBlock + param->numBlocks));
+    
+    if( (param->buf != NULL) && (param->bufLen < ((uint32_t)(lastBlock - param->firstBlock) * info.blockLen)) )
+    {
+        return ERR_NOMEM;
+    }
+    
+    /* The Option flag prefixes each block with its security status */
+    entryLen  = (info.blockLen + ((param->flags & RFAL_NFCV_REQ_FLAG_OPTION) ? 1 : 0));
+    maxBlocks = (RFAL_NFCV_READ_MAX_DATA_LEN / entryLen);
+    if( param->maxBlocksPerRead != 0 )
+    {
+        maxBlocks = MIN( maxBlocks, param->maxBlocksPerRead );
+    }
+    
+    if( maxBlocks == 0 )
+    {
+        return ERR_PARAM;
+    }
+    
+    isExt  = (lastBlock > RFAL_NFCV_STD_MAX_BLOCKS);
+    isFast = (gNfcv.fastMode && !((param->uid != NULL) && gNfcv.isNoFastUidValid && (ST_BYTECMP( gNfcv.noFastUid, param->uid, RFAL_NFCV_UID_LEN ) == 0)));
+    EXIT_ON_ERR( ret, rfalGetBitRate( &txBR, &rxBR ) );
+    
+    /*******************************************************************************/
+    /* Compute the first request                                                   */
+    cur              = 0;
+    offset           = 0;
+    retries          = 0;
+    isNextReady      = false;
+    isAnyRead        = false;
+    
+    chunkFirst[cur]  = param->firstBlock;
+    chunkBlocks[cur] = MIN( maxBlocks, (lastBlock - param->firstBlock) );
+    reqLen[cur]      = rfalNfvComputeReadReq( &req[cur], param->flags, param->uid, chunkFirst[cur], chunkBlocks[cur], isExt, isFast );
+    nextBlock        = (chunkFirst[cur] + chunkBlocks[cur]);
+    
+    while( true )
+    {
+        /*******************************************************************************/
+        /* Transmit the current chunk request                                          */
+        if( isFast )
+        {
+            rfalSetBitRate( RFAL_BR_KEEP, RFAL_BR_52p97, mspiChannel, mST25, gpio_cs, IRQ, fieldLED_01, fieldLED_02, fieldLED_03, fieldLED_04, fieldLED_05, fieldLED_06 );
+        }
+        
+        rfalCreateByteFlagsTxRxContext( ctx, (uint8_t*)&req[cur], reqLen[cur], rxBuf, RFAL_NFCV_READ_BUF_LEN, &rxLen, RFAL_TXRX_FLAGS_DEFAULT, RFAL_FDT_POLL_MAX );
+        ret = rfalStartTransceive( &ctx, mspiChannel, mST25, gpio_cs, IRQ, fieldLED_01, fieldLED_02, fieldLED_03, fieldLED_04, fieldLED_05, fieldLED_06 );
+        
+        if( ret == ERR_NONE )
+        {
+            do{
+                rfalWorker( mspiChannel, mST25, gpio_cs, IRQ, fieldLED_01, fieldLED_02, fieldLED_03, fieldLED_04, fieldLED_05, fieldLED_06 );
+            }
+            while( ((ret = rfalGetTransceiveStatus()) == ERR_BUSY) && rfalIsTransceiveInTx() );
+            
+            /*******************************************************************************/
+            /* While the response is awaited compute the next request (a few us). The     */
+            /* data is delivered once received: the worker must drain the FIFO all along  */
+            /* the reception as a response may be larger than the FIFO                    */
+            if( !isNextReady && (nextBlock < lastBlock) )
+            {
+                chunkFirst[(cur ^ 1)]  = nextBlock;
+                chunkBlocks[(cur ^ 1)] = MIN( maxBlocks, (lastBlock - nextBlock) );
+                reqLen[(cur ^ 1)]      = rfalNfvComputeReadReq( &req[(cur ^ 1)], param->flags, param->uid, chunkFirst[(cur ^ 1)], chunkBlocks[(cur ^ 1)], isExt, isFast );
+                isNextReady            = true;
+            }
+            
+            while( (ret = rfalGetTransceiveStatus()) == ERR_BUSY )
+            {
+                rfalWorker( mspiChannel, mST25, gpio_cs, IRQ, fieldLED_01, fieldLED_02, fieldLED_03, fieldLED_04, fieldLED_05, fieldLED_06 );
+            }
+        }
+        
+        if( isFast )
+        {
+            rfalSetBitRate( txBR, rxBR, mspiChannel, mST25, gpio_cs, IRQ, fieldLED_01, fieldLED_02, fieldLED_03, fieldLED_04, fieldLED_05, fieldLED_06 );
+        }
+        
+        /*******************************************************************************/
+        /* Check the response                                                          */
+        rxLen = rfalConvBitsToBytes( rxLen );
+        
+        if( ret == ERR_NONE )
+        {
+            if( rxLen < RFAL_NFCV_FLAG_LEN )
+            {
+                ret = ERR_PROTO;
+            }
+            else if( rxBuf[0] & RFAL_NFCV_RES_FLAG_ERROR )
+            {
+                ret = rfalNfvParseError( rxBuf[RFAL_NFCV_FLAG_LEN] );
+            }
+            else if( rxLen != (RFAL_NFCV_FLAG_LEN + (chunkBlocks[cur] * entryLen)) )
+            {
+                ret = ERR_PROTO;
+            }
+        }
+        
+        if( ret == ERR_WRONG_STATE )
+        {
+            break;
+        }
+        
+        if( ret != ERR_NONE )
+        {
+            /* A device not answering fast commands is read with the standard ones */
+            if( isFast && !isAnyRead && ((ret == ERR_TIMEOUT) || (ret == ERR_NOTSUPP) || (ret == ERR_PROTO) || (ret == ERR_FRAMING)) )
+            {
+                isFast      = false;
+                isNextReady = false;
+                reqLen[cur] = rfalNfvComputeReadReq( &req[cur], param->flags, param->uid, chunkFirst[cur], chunkBlocks[cur], isExt, isFast );
+                
+                if( param->uid != NULL )
+                {
+                    ST_MEMCPY( gNfcv.noFastUid, param->uid, RFAL_NFCV_UID_LEN );
+                    gNfcv.isNoFastUidValid = true;
+                }
+                continue;
+            }
+            
+            /* Only the failed chunk is retried */
+            if( retries++ >= param->retries )
+            {
+                break;
+            }
+            continue;
+        }
+        
+        /*******************************************************************************/
+        /* Chunk received, deliver it before the next exchange                         */
+        retries   = 0;
+        isAnyRead = true;
+        
+        ret = rfalNfvReadDeliver( param, rxBuf, chunkFirst[cur], chunkBlocks[cur], entryLen, info.blockLen, &offset );
+        if( (ret != ERR_NONE) || !isNextReady )
+        {
+            break;
+        }
+        
+        nextBlock   = (chunkFirst[(cur ^ 1)] + chunkBlocks[(cur ^ 1)]);
+        isNextReady = false;
+        cur        ^= 1;
+    }
+    
+    if( rcvdLen != NULL )
+    {
+        *rcvdLen = offset;
+    }
+    
+    return ret;
+}
+
+/*******************************************************************************/
+ReturnCode rfalNfcvPollerSetFastMode( bool enable, uint8_t mfgCode )
+{
+    gNfcv.fastMode         = enable;
+    gNfcv.mfgCode          = mfgCode;
+    gNfcv.isNoFastUidValid = false;
+    
+    return ERR_NONE;
+}
+
+/*******************************************************************************/
+ReturnCode rfalNfvInitiate( uint8_t flags, SPI* mspiChannel, ST25R3911* mST25, DigitalOut* gpio_cs, InterruptIn* IRQ, DigitalOut* fieldLED_01, DigitalOut* fieldLED_02, DigitalOut* fieldLED_03, DigitalOut* fieldLED_04, DigitalOut* fieldLED_05, DigitalOut* fieldLED_06 )
+{
+    ReturnCode         ret;
+    rfalNfcvGenericReq req;
+    rfalNfcvGenericRes res;
+    uint16_t           rcvLen;
+    
+    req.REQ_FLAG = (flags & (~RFAL_NFCV_REQ_FLAG_ADDRESS & ~RFAL_NFCV_REQ_FLAG_SELECT));
+    req.CMD      = RFAL_NFCV_CMD_INITIATE;
+    req.payload.data[0] = gNfcv.mfgCode;
+    
+    /* All devices in the field answer, only the state change is relevant */
+    ret = rfalTransceiveBlockingTxRx( (uint8_t*)&req, (RFAL_CMD_LEN + RFAL_NFCV_FLAG_LEN + RFAL_NFCV_MFG_CODE_LEN), (uint8_t*)&res, sizeof(rfalNfcvGenericRes), &rcvLen, RFAL_TXRX_FLAGS_DEFAULT, RFAL_FDT_POLL_MAX, mspiChannel, mST25, gpio_cs, IRQ, fieldLED_01, fieldLED_02, fieldLED_03, fieldLED_04, fieldLED_05, fieldLED_06 ) ;
+    if( (ret == ERR_TIMEOUT) || (ret == ERR_RF_COLLISION) || (ret == ERR_CRC) || (ret == ERR_FRAMING) )
+    {
+        return ERR_NONE;
+    }
+    
+    return ret;
+}
+
+/*******************************************************************************/
+ReturnCode rfalNfcvPollerFastInventory( uint8_t maskLen, uint8_t *maskVal, rfalNfcvInventoryRes *invRes, uint16_t* rcvdLen, SPI* mspiChannel, ST25R3911* mST25, DigitalOut* gpio_cs, InterruptIn* IRQ, DigitalOut* fieldLED_01, DigitalOut* fieldLED_02, DigitalOut* fieldLED_03, DigitalOut* fieldLED_04, DigitalOut* fieldLED_05, DigitalOut* fieldLED_06 )
+{
+    ReturnCode         ret;
+    rfalNfcvGenericReq req;
+    uint16_t           rxLen;
+    uint8_t            msgIt;
+    
+    if( (invRes == NULL) || ((maskLen != 0) && (maskVal == NULL)) || (maskLen > RFAL_NFCV_MASKVAL_MAX_1SLOT_LEN) )
+    {
+        return ERR_PARAM;
+    }
+    
+    /* Without fast mode the standard INVENTORY_REQ is used */
+    if( !gNfcv.fastMode )
+    {
+        return rfalNfcvPollerInventory( RFAL_NFCV_NUM_SLOTS_1, maskLen, maskVal, invRes, rcvdLen, mspiChannel, mST25, gpio_cs, IRQ, fieldLED_01, fieldLED_02, fieldLED_03, fieldLED_04, fieldLED_05, fieldLED_06 );
+    }
+    
+    EXIT_ON_ERR( ret, rfalNfvInitiate( RFAL_NFCV_REQ_FLAG_DEFAULT, mspiChannel, mST25, gpio_cs, IRQ, fieldLED_01, fieldLED_02, fieldLED_03, fieldLED_04, fieldLED_05, fieldLED_06 ) );
+    
+    /* Same layout as INVENTORY_REQ plus the IC Manufacturer code, in 1 slot */
+    msgIt = 0;
+    req.REQ_FLAG                 = (RFAL_NFCV_INV_REQ_FLAG | RFAL_NFCV_NUM_SLOTS_1);
+    req.CMD                      = RFAL_NFCV_CMD_FAST_INVENTORY_INITIATED;
+    req.payload.data[msgIt++]    = gNfcv.mfgCode;
+    req.payload.data[msgIt++]    = maskLen;
+    ST_MEMCPY( &req.payload.data[msgIt], maskVal, rfalConvBitsToBytes(maskLen) );
+    msgIt += rfalConvBitsToBytes(maskLen);
+    
+    ret = rfalNfvFastTransceive( (uint8_t*)&req, (RFAL_CMD_LEN + RFAL_NFCV_FLAG_LEN + msgIt), (uint8_t*)invRes, sizeof(rfalNfcvInventoryRes), &rxLen, mspiChannel, mST25, gpio_cs, IRQ, fieldLED_01, fieldLED_02, fieldLED_03, fieldLED_04, fieldLED_05, fieldLED_06 );
+    
+    /* Check for optional output parameter */
+    if( rcvdLen != NULL )
+    {
+        *rcvdLen = rxLen;
+    }
+    
+    /* Devices not supporting fast commands stay silent, retried with the standard INVENTORY_REQ */
+    if( ret == ERR_TIMEOUT )
+    {
+        return rfalNfcvPollerInventory( RFAL_NFCV_NUM_SLOTS_1, maskLen, maskVal, invRes, rcvdLen, mspiChannel, mST25, gpio_cs, IRQ, fieldLED_01, fieldLED_02, fieldLED_03, fieldLED_04, fieldLED_05, fieldLED_06 );
+    }
+    
+    if( ret == ERR_NONE )
+    {
+        if( rxLen != rfalConvBytesToBits(RFAL_NFCV_INV_RES_LEN + RFAL_NFCV_CRC_LEN) )
+        {
+            return ERR_PROTO;
+        }
+    }
+    
+    return ret;
+}
+
+/*******************************************************************************/
+ReturnCode rfalNfcvPopulationInitialize( rfalNfcvPopulation *pop, rfalNfcvPopEntry *entries, uint16_t entriesLen, uint32_t checkPeriod, rfalNfcvPopEventCb evtCb )
+{
+    if( (pop == NULL) || (entries == NULL) || (entriesLen == 0) )
+    {
+        return ERR_PARAM;
+    }
+    
+    ST_MEMSET( entries, 0x00, (sizeof(rfalNfcvPopEntry) * entriesLen) );
+    ST_MEMSET( pop, 0x00, sizeof(rfalNfcvPopulation) );
+    
+    pop->entries     = entries;
+    pop->entriesLen  = entriesLen;
+    pop->checkPeriod = checkPeriod;
+    pop->evtCb       = evtCb;
+    pop->checkTimer  = platformTimerCreate( 0 );
+    
+    return ERR_NONE;
+}
+
+/*******************************************************************************/
+ReturnCode rfalNfcvPopulationUpdate( rfalNfcvPopulation *pop, uint16_t *newCnt, SPI* mspiChannel, ST25R3911* mST25, DigitalOut* gpio_cs, InterruptIn* IRQ, DigitalOut* fieldLED_01, DigitalOut* fieldLED_02, DigitalOut* fieldLED_03, DigitalOut* fieldLED_04, DigitalOut* fieldLED_05, DigitalOut* fieldLED_06 )
+{
+    ReturnCode           ret;
+    ReturnCode           invRet;
+    rfalNfcvInventoryIt  it;
+    rfalNfcvCollision    stack[RFAL_NFCV_ADAPT_MAX_NODES];
+    rfalNfcvListenDevice dev;
+    rfalNfcvPopEntry     *entry;
+    uint8_t              rxBuf[(RFAL_NFCV_FLAG_LEN + RFAL_NFCV_MAX_BLOCK_LEN + RFAL_NFCV_CRC_LEN)];
+    uint16_t             rcvLen;
+    uint16_t             i;
+    bool                 full;
+    
+    if( (pop == NULL) || (pop->entries == NULL) )
+    {
+        return ERR_PARAM;
+    }
+    
+    full = false;
+    if( newCnt != NULL )
+    {
+        *newCnt = 0;
+    }
+    
+    /*******************************************************************************/
+    /* Check the presence of known devices, Quiet devices answer addressed commands */
+    if( platformTimerIsExpired( pop->checkTimer ) )
+    {
+        for( i = 0; i < pop->entriesLen; i++ )
+        {
+            entry = &pop->entries[i];
+            if( entry->state != RFAL_NFCV_POP_ENTRY_USED )
+            {
+                continue;
+            }
+            
+            /* Any answer, even an error or a corrupted one, means the device is present */
+            ret = rfalNfvReadSingleBlock( RFAL_NFCV_REQ_FLAG_DEFAULT, entry->uid, RFAL_NFCV_POP_CHECK_BLOCK, rxBuf, sizeof(rxBuf), &rcvLen, mspiChannel, mST25, gpio_cs, IRQ, fieldLED_01, fieldLED_02, fieldLED_03, fieldLED_04, fieldLED_05, fieldLED_06 );
+            if( ret == ERR_WRONG_STATE )
+            {
+                return ret;
+            }
+            
+            if( ret != ERR_TIMEOUT )
+            {
+                entry->missCnt = 0;
+                continue;
+            }
+            
+            if( ++entry->missCnt >= RFAL_NFCV_POP_MISS_MAX )
+            {
+                entry->state = RFAL_NFCV_POP_ENTRY_DELETED;
+                pop->devCnt--;
+                pop->delCnt++;
+                
+                if( pop->evtCb != NULL )
+                {
+                    pop->evtCb( entry->uid, RFAL_NFCV_POP_EVT_DEPARTURE );
+                }
+            }
+        }
+        
+        /* Once only deleted entries are left a lookup would scan the whole table */
+        if( (pop->devCnt == 0) && (pop->delCnt != 0) )
+        {
+            ST_MEMSET( pop->entries, 0x00, (sizeof(rfalNfcvPopEntry) * pop->entriesLen) );
+            pop->delCnt = 0;
+        }
+        
+        pop->checkTimer = platformTimerCreate( pop->checkPeriod );
+    }
+    
+    /*******************************************************************************/
+    /* Inventory the devices not in Quiet state: new arrivals or reset devices      */
+    EXIT_ON_ERR( ret, rfalNfcvPollerInventoryStart( &it, stack, RFAL_NFCV_ADAPT_MAX_NODES, 0, false ) );
+    
+    do
+    {
+        invRet = rfalNfcvPollerInventoryNext( &it, &dev, mspiChannel, mST25, gpio_cs, IRQ, fieldLED_01, fieldLED_02, fieldLED_03, fieldLED_04, fieldLED_05, fieldLED_06 );
+        if( invRet != ERR_NONE )
+        {
+            break;
+        }
+        
+        /* A known device answering was reset, it is put back to Quiet without being reported */
+        entry = rfalNfcvPopFind( pop, dev.InvRes.UID, false );
+        if( entry != NULL )
+        {
+            entry->isQuiet = false;
+            entry->missCnt = 0;
+            continue;
+        }
+        
+        entry = rfalNfcvPopFind( pop, dev.InvRes.UID, true );
+        if( entry == NULL )
+        {
+            full = true;
+            continue;
+        }
+        
+        if( newCnt != NULL )
+        {
+            (*newCnt)++;
+        }
+        
+        if( pop->evtCb != NULL )
+        {
+            pop->evtCb( entry->uid, RFAL_NFCV_POP_EVT_ARRIVAL );
+        }
+    }
+    while( true );
+    
+    if( invRet == ERR_WRONG_STATE )
+    {
+        return invRet;
+    }
+    
+    /*******************************************************************************/
+    /* Put to Quiet the devices found, only once the inventory is done             */
+    for( i = 0; i < pop->entriesLen; i++ )
+    {
+        entry = &pop->entries[i];
+        if( (entry->state == RFAL_NFCV_POP_ENTRY_USED) && !entry->isQuiet )
+        {
+            EXIT_ON_ERR( ret, rfalNfvPollerSleep( RFAL_NFCV_REQ_FLAG_DEFAULT, entry->uid, mspiChannel, mST25, gpio_cs, IRQ, fieldLED_01, fieldLED_02, fieldLED_03, fieldLED_04, fieldLED_05, fieldLED_06 ) );
+            entry->isQuiet = true;
+        }
+    }
+    
+    if( full )
+    {
+        return ERR_NOMEM;
+    }
+    
+    return ((invRet == ERR_RF_COLLISION) ? ERR_RF_COLLISION : ERR_NONE);
+}
+
+/*******************************************************************************/
+ReturnCode rfalNfcvPopulationResetToReady( rfalNfcvPopulation *pop, bool sendCmd, SPI* mspiChannel, ST25R3911* mST25, DigitalOut* gpio_cs, InterruptIn* IRQ, DigitalOut* fieldLED_01, DigitalOut* fieldLED_02, DigitalOut* fieldLED_03, DigitalOut* fieldLED_04, DigitalOut* fieldLED_05, DigitalOut* fieldLED_06 )
+{
+    ReturnCode ret;
+    uint16_t   i;
+    
+    if( (pop == NULL) || (pop->entries == NULL) )
+    {
+        return ERR_PARAM;
+    }
+    
+    if( sendCmd )
+    {
+        EXIT_ON_ERR( ret, rfalNfvResetToReady( RFAL_NFCV_REQ_FLAG_DEFAULT, NULL, mspiChannel, mST25, gpio_cs, IRQ, fieldLED_01, fieldLED_02, fieldLED_03, fieldLED_04, fieldLED_05, fieldLED_06 ) );
+    }
+    
+    for( i = 0; i < pop->entriesLen; i++ )
+    {
+        pop->entries[i].isQuiet = false;
+    }
+    
+    return ERR_NONE;
+}
+
+/*******************************************************************************/
+uint32_t rfalNfcvGetRequestAirtime( uint16_t reqLen )
+{
+    rfalBitRate txBR;
+    rfalBitRate rxBR;
+    
+    rfalGetBitRate( &txBR, &rxBR );
+    
+    return ((uint32_t)(reqLen + RFAL_NFCV_CRC_LEN) * ((txBR == RFAL_BR_1p66) ? RFAL_NFCV_1OF256_BYTE_US : RFAL_NFCV_1OF4_BYTE_US)) + RFAL_NFCV_SOF_EOF_US;
+}
+
+/*******************************************************************************/
+ReturnCode rfalNfcvSessionOpen( rfalNfcvSession *session, uint8_t flags, const uint8_t* uid, SPI* mspiChannel, ST25R3911* mST25, DigitalOut* gpio_cs, InterruptIn* IRQ, DigitalOut* fieldLED_01, DigitalOut* fieldLED_02, DigitalOut* fieldLED_03, DigitalOut* fieldLED_04, DigitalOut* fieldLED_05, DigitalOut* fieldLED_06 )
+{
+    ReturnCode ret;
+    
+    if( (session == NULL) || (uid == NULL) )
+    {
+        return ERR_PARAM;
+    }
+    
+    ST_MEMSET( session, 0x00, sizeof(rfalNfcvSession) );
+    ST_MEMCPY( session->uid, uid, RFAL_NFCV_UID_LEN );
+    session->flags = flags;
+    
+    /* A device not supporting Select is kept in Addressed mode */
+    ret = rfalNfvSelect( flags, session->uid, mspiChannel, mST25, gpio_cs, IRQ, fieldLED_01, fieldLED_02, fieldLED_03, fieldLED_04, fieldLED_05, fieldLED_06 );
+    rfalNfcvSessionAccount( session, 0 );
+    
+    if( ret == ERR_WRONG_STATE )
+    {
+        return ret;
+    }
+    
+    session->isSelected = (ret == ERR_NONE);
+    return ERR_NONE;
+}
+
+/*******************************************************************************/
+ReturnCode rfalNfcvSessionClose( rfalNfcvSession *session, SPI* mspiChannel, ST25R3911* mST25, DigitalOut* gpio_cs, InterruptIn* IRQ, DigitalOut* fieldLED_01, DigitalOut* fieldLED_02, DigitalOut* fieldLED_03, DigitalOut* fieldLED_04, DigitalOut* fieldLED_05, DigitalOut* fieldLED_06 )
+{
+    if( session == NULL )
+    {
+        return ERR_PARAM;
+    }
+    
+    if( !session->isSelected )
+    {
+        return ERR_NONE;
+    }
+    
+    session->isSelected = false;
+    rfalNfcvSessionAccount( session, 0 );
+    
+    return rfalNfvResetToReady( session->flags, session->uid, mspiChannel, mST25, gpio_cs, IRQ, fieldLED_01, fieldLED_02, fieldLED_03, fieldLED_04, fieldLED_05, fieldLED_06 );
+}
+
+/*******************************************************************************/
+ReturnCode rfalNfcvSessionReadSingleBlock( rfalNfcvSession *session, uint8_t blockNum, uint8_t* rxBuf, uint16_t rxBufLen, uint16_t *rcvLen, SPI* mspiChannel, ST25R3911* mST25, DigitalOut* gpio_cs, InterruptIn* IRQ, DigitalOut* fieldLED_01, DigitalOut* fieldLED_02, DigitalOut* fieldLED_03, DigitalOut* fieldLED_04, DigitalOut* fieldLED_05, DigitalOut* fieldLED_06 )
+{
+    ReturnCode ret;
+    
+    if( session == NULL )
+    {
+        return ERR_PARAM;
+    }
+    
+    if( session->isSelected )
+    {
+        rfalNfcvSessionAccount( session, sizeof(uint8_t) );
+        ret = rfalNfvReadSingleBlock( session->flags, NULL, blockNum, rxBuf, rxBufLen, rcvLen, mspiChannel, mST25, gpio_cs, IRQ, fieldLED_01, fieldLED_02, fieldLED_03, fieldLED_04, fieldLED_05, fieldLED_06 );
+        if( ret != ERR_TIMEOUT )
+        {
+            return ret;
+        }
+        
+        /* A device no longer Selected (reset or other device selected) stays silent, use its UID */
+        session->isSelected = false;
+    }
+    
+    rfalNfcvSessionAccount( session, sizeof(uint8_t) );
+    return rfalNfvReadSingleBlock( session->flags, session->uid, blockNum, rxBuf, rxBufLen, rcvLen, mspiChannel, mST25, gpio_cs, IRQ, fieldLED_01, fieldLED_02, fieldLED_03, fieldLED_04, fieldLED_05, fieldLED_06 );
+}
+
+/*******************************************************************************/
+ReturnCode rfalNfcvSessionWriteSingleBlock( rfalNfcvSession *session, uint8_t blockNum, uint8_t* wrData, uint8_t blockLen, SPI* mspiChannel, ST25R3911* mST25, DigitalOut* gpio_cs, InterruptIn* IRQ, DigitalOut* fieldLED_01, DigitalOut* fieldLED_02, DigitalOut* fieldLED_03, DigitalOut* fieldLED_04, DigitalOut* fieldLED_05, DigitalOut* fieldLED_06 )
+{
+    ReturnCode ret;
+    
+    if( session == NULL )
+    {
+        return ERR_PARAM;
+    }
+    
+    if( session->isSelected )
+    {
+        rfalNfcvSessionAccount( session, (sizeof(uint8_t) + blockLen) );
+        ret = rfalNfvWriteSingleBlock( session->flags, NULL, blockNum, wrData, blockLen, mspiChannel, mST25, gpio_cs, IRQ, fieldLED_01, fieldLED_02, fieldLED_03, fieldLED_04, fieldLED_05, fieldLED_06 );
+        if( ret != ERR_TIMEOUT )
+        {
+            return ret;
+        }
+        
+        session->isSelected = false;
+    }
+    
+    rfalNfcvSessionAccount( session, (sizeof(uint8_t) + blockLen) );
+    return rfalNfvWriteSingleBlock( session->flags, session->uid, blockNum, wrData, blockLen, mspiChannel, mST25, gpio_cs, IRQ, fieldLED_01, fieldLED_02, fieldLED_03, fieldLED_04, fieldLED_05, fieldLED_06 );
+}
+
+/*******************************************************************************/
+ReturnCode rfalNfcvSessionReadMultipleBlocks( rfalNfcvSession *session, uint8_t firstBlockNum, uint8_t numOfBlocks, uint8_t* rxBuf, uint16_t rxBufLen, uint16_t *rcvLen, SPI* mspiChannel, ST25R3911* mST25, DigitalOut* gpio_cs, InterruptIn* IRQ, DigitalOut* fieldLED_01, DigitalOut* fieldLED_02, DigitalOut* fieldLED_03, DigitalOut* fieldLED_04, DigitalOut* fieldLED_05, DigitalOut* fieldLED_06 )
+{
+    ReturnCode ret;
+    
+    if( session == NULL )
+    {
+        return ERR_PARAM;
+    }
+    
+    if( session->isSelected )
+    {
+        rfalNfcvSessionAccount( session, (2 * sizeof(uint8_t)) );
+        ret = rfalNfvReadMultipleBlocks( session->flags, NULL, firstBlockNum, numOfBlocks, rxBuf, rxBufLen, rcvLen, mspiChannel, mST25, gpio_cs, IRQ, fieldLED_01, fieldLED_02, fieldLED_03, fieldLED_04, fieldLED_05, fieldLED_06 );
+        if( ret != ERR_TIMEOUT )
+        {
+            return ret;
+        }
+        
+        session->isSelected = false;
+    }
+    
+    rfalNfcvSessionAccount( session, (2 * sizeof(uint8_t)) );
+    return rfalNfvReadMultipleBlocks( session->flags, session->uid, firstBlockNum, numOfBlocks, rxBuf, rxBufLen, rcvLen, mspiChannel, mST25, gpio_cs, IRQ, fieldLED_01, fieldLED_02, fieldLED_03, fieldLED_04, fieldLED_05, fieldLED_06 );
+}
+
+/*******************************************************************************/
+ReturnCode rfalNfcvSessionWriteMultipleBlocks( rfalNfcvSession *session, uint16_t firstBlockNum, uint8_t numOfBlocks, const uint8_t* wrData, uint8_t blockLen, SPI* mspiChannel, ST25R3911* mST25, DigitalOut* gpio_cs, InterruptIn* IRQ, DigitalOut* fieldLED_01, DigitalOut* fieldLED_02, DigitalOut* fieldLED_03, DigitalOut* fieldLED_04, DigitalOut* fieldLED_05, DigitalOut* fieldLED_06 )
+{
+    ReturnCode ret;
+    uint16_t   paramLen;
+    
+    if( session == NULL )
+    {
+        return ERR_PARAM;
+    }
+    
+    paramLen = ((2 * sizeof(uint8_t)) + ((uint16_t)numOfBlocks * blockLen));
+    
+    if( session->isSelected )
+    {
+        rfalNfcvSessionAccount( session, paramLen );
+        ret = rfalNfvWriteMultipleBlocks( session->flags, NULL, firstBlockNum, numOfBlocks, wrData, blockLen, mspiChannel, mST25, gpio_cs, IRQ, fieldLED_01, fieldLED_02, fieldLED_03, fieldLED_04, fieldLED_05, fieldLED_06 );
+        if( ret != ERR_TIMEOUT )
+        {
+            return ret;
+        }
+        
+        session->isSelected = false;
+    }
+    
+    rfalNfcvSessionAccount( session, paramLen );
+    return rfalNfvWriteMultipleBlocks( session->flags, session->uid, firstBlockNum, numOfBlocks, wrData, blockLen, mspiChannel, mST25, gpio_cs, IRQ, fieldLED_01, fieldLED_02, fieldLED_03, fieldLED_04, fieldLED_05, fieldLED_06 );
 }
 
 #endif /* RFAL_FEATURE_NFCV */
@@ -68,6 +68,17 @@
  */
 #define RFAL_NFCV_UID_LEN                           8    /*!< NFC-V UID length  */
 #define RFAL_NFCV_MAX_BLOCK_LEN           32    /*!< Max Block size: can be of up to 256 bits  ISO 15693 2000  5       */
+#define RFAL_NFCV_COLL_STACK_LEN_MIN      2     /*!< Min collision work stack length: one mask split in two            */
+#define RFAL_NFCV_COLL_STACK_LEN          144   /*!< Collision work stack length that never drops a mask (64 bits UID) */
+#define RFAL_NFCV_ADAPT_MAX_NODES         32    /*!< Maximum pending masks on the adaptive Anticollision loop          */
+#define RFAL_NFCV_POP_MISS_MAX            2     /*!< Consecutive missed presence checks before a device is departed    */
+
+#define RFAL_NFCV_MFG_CODE_ST             0x02  /*!< IC Manufacturer code: STMicroelectronics  ISO/IEC 7816-6          */
+#define RFAL_NFCV_MFG_CODE_NXP            0x04  /*!< IC Manufacturer code: NXP Semiconductors  ISO/IEC 7816-6          */
+
+#define RFAL_NFCV_READ_MAX_DATA_LEN       256   /*!< Max data per Read Multiple Blocks response, bound by the RF coding buffer */
+#define RFAL_NFCV_READ_RETRIES            2     /*!< Default retries of a failed chunk on the memory read engine       */
+#define RFAL_NFCV_WRITE_MAX_DATA_LEN      32    /*!< Max data per Write Multiple Blocks request, bound by the request buffer */
 
 
 
@@ -125,7 +136,21 @@ enum
     RFAL_NFCF_CMD_SELECT                 = 0x25,      /*!< Select command                                               */
     RFAL_NFCF_CMD_RESET_TO_READY         = 0x26,      /*!< Reset To Ready command                                       */
     RFAL_NFCF_CMD_GET_SYS_INFO           = 0x2B,      /*!< Get System Information command                               */
-    RFAL_NFCF_CMD_EXTENDED_GET_SYS_INFO  = 0x2B       /*!< Extended Get System Information command (ST Proprietary)     */
+    RFAL_NFCF_CMD_EXTENDED_READ_SINGLE_BLOCK    = 0x30, /*!< Extended Read single block command                         */
+    RFAL_NFCF_CMD_EXTENDED_WRITE_SINGLE_BLOCK   = 0x31, /*!< Extended Write single block command                        */
+    RFAL_NFCF_CMD_EXTENDED_READ_MULTIPLE_BLOCKS = 0x33, /*!< Extended Read multiple blocks command                      */
+    RFAL_NFCF_CMD_EXTENDED_WRITE_MULTIPLE_BLOCKS= 0x34, /*!< Extended Write multiple blocks command                     */
+    RFAL_NFCF_CMD_EXTENDED_GET_SYS_INFO  = 0x3B       /*!< Extended Get System Information command                      */
+};
+
+/*! NFC-V custom command set, answered at 53kbps (fast)   ISO15693 2000 10.5 */
+enum
+{
+    RFAL_NFCV_CMD_FAST_READ_SINGLE_BLOCK      = 0xC0, /*!< Fast Read single block command                               */
+    RFAL_NFCV_CMD_FAST_READ_MULTIPLE_BLOCKS   = 0xC3, /*!< Fast Read multiple blocks command                            */
+    RFAL_NFCV_CMD_FAST_EXT_READ_MULTIPLE_BLOCKS = 0xC5, /*!< Fast Extended Read multiple blocks command                 */
+    RFAL_NFCV_CMD_FAST_INVENTORY_INITIATED    = 0xD1, /*!< Fast Inventory Initiated command                             */
+    RFAL_NFCV_CMD_INITIATE                    = 0xD2  /*!< Initiate command, enables Fast Inventory Initiated           */
 };
 
 /*
@@ -167,6 +192,141 @@ typedef struct
 } rfalNfcvListenDevice;
 
 
+/*! NFC-V collision: mask prefix pending resolution on the Anticollision loop */
+typedef struct
+{
+    uint8_t  maskLen;                       /*!< Mask length in bits                           */
+    uint8_t  maskVal[RFAL_NFCV_UID_LEN];    /*!< Mask value                                    */
+    uint16_t popEst;                        /*!< Estimated devices matching the mask           */
+} rfalNfcvCollision;
+
+
+/*! NFC-V inventory iterator, holds the Anticollision loop state between calls */
+typedef struct
+{
+    rfalNfcvCollision *stack;               /*!< Caller provided work stack of pending masks   */
+    uint16_t           stackLen;            /*!< Work stack length                             */
+    uint16_t           stackCnt;            /*!< Pending masks on the work stack               */
+    rfalNfcvCollision  cur;                 /*!< Mask currently being resolved                 */
+    uint8_t            slotNum;             /*!< Current slot on an ongoing 16 slots round     */
+    bool               isRoundOngoing;      /*!< 16 slots round ongoing flag                   */
+    uint16_t           accounted;           /*!< Devices found and estimated on current round  */
+    uint8_t            roundEmpty;          /*!< Empty slots seen on current round             */
+    uint8_t            roundSingle;         /*!< Single device slots seen on current round     */
+    uint8_t            roundColl;           /*!< Collided slots seen on current round          */
+    uint16_t           roundBase;           /*!< Work stack count when current round started   */
+    bool               earlyStop;           /*!< End rounds once the estimate is accounted for */
+    uint16_t           devCnt;              /*!< Devices resolved so far                       */
+    uint16_t           slots;               /*!< Slots used so far                             */
+    bool               dropped;             /*!< Mask(s) dropped due to a full work stack      */
+} rfalNfcvInventoryIt;
+
+
+/*! NFC-V population event */
+typedef enum
+{
+    RFAL_NFCV_POP_EVT_ARRIVAL    = 0,       /*!< New device found on the field                 */
+    RFAL_NFCV_POP_EVT_DEPARTURE  = 1,       /*!< Known device no longer answers                */
+} rfalNfcvPopEvent;
+
+
+/*! NFC-V population event callback, called with the UID of the device */
+typedef void (* rfalNfcvPopEventCb)( const uint8_t *uid, rfalNfcvPopEvent evt );
+
+
+/*! NFC-V population entry state */
+typedef enum
+{
+    RFAL_NFCV_POP_ENTRY_FREE     = 0,       /*!< Entry never used, ends a probe sequence       */
+    RFAL_NFCV_POP_ENTRY_USED     = 1,       /*!< Entry holds a known device                    */
+    RFAL_NFCV_POP_ENTRY_DELETED  = 2,       /*!< Entry of a departed device, may be reused     */
+} rfalNfcvPopEntryState;
+
+
+/*! NFC-V population entry: a known device */
+typedef struct
+{
+    uint8_t                uid[RFAL_NFCV_UID_LEN];  /*!< Device UID                                */
+    rfalNfcvPopEntryState  state;                   /*!< Entry state                               */
+    bool                   isQuiet;                 /*!< Device put in Quiet state by SLPV_REQ     */
+    uint8_t                missCnt;                 /*!< Consecutive missed presence checks        */
+} rfalNfcvPopEntry;
+
+
+/*! NFC-V population: hash set of known devices, kept between inventories */
+typedef struct
+{
+    rfalNfcvPopEntry   *entries;            /*!< Caller provided hash table                    */
+    uint16_t            entriesLen;         /*!< Hash table length                             */
+    uint16_t            devCnt;             /*!< Known devices                                 */
+    uint16_t            delCnt;             /*!< Deleted entries on the table                  */
+    rfalNfcvPopEventCb  evtCb;              /*!< Event callback (optional)                     */
+    uint32_t            checkPeriod;        /*!< Presence check period in ms (0: every update) */
+    uint32_t            checkTimer;         /*!< Presence check timer                          */
+} rfalNfcvPopulation;
+
+
+/*! NFC-V System Information  ISO15693 2000 9.3.12 */
+typedef struct
+{
+    uint8_t   infoFlags;                    /*!< Information flags                             */
+    uint8_t   uid[RFAL_NFCV_UID_LEN];       /*!< Device UID                                    */
+    uint8_t   dsfid;                        /*!< DSFID, if signalled on infoFlags              */
+    uint8_t   afi;                          /*!< AFI, if signalled on infoFlags                */
+    uint16_t  numBlocks;                    /*!< Number of blocks (0 if not signalled)         */
+    uint8_t   blockLen;                     /*!< Block length in bytes (0 if not signalled)    */
+    uint8_t   icRef;                        /*!< IC reference, if signalled on infoFlags       */
+    bool      isExtended;                   /*!< Obtained with Extended Get System Information */
+} rfalNfcvSystemInfo;
+
+
+/*! NFC-V memory read callback, called in block order with whole blocks of data
+ *  It is called between exchanges, once a chunk has been received             */
+typedef ReturnCode (* rfalNfcvMemReadCb)( uint16_t blockNum, const uint8_t *data, uint16_t len );
+
+
+/*! NFC-V memory read parameters */
+typedef struct
+{
+    uint8_t            flags;               /*!< Request flags, RFAL_NFCV_REQ_FLAG_DEFAULT     */
+    uint8_t           *uid;                 /*!< Device UID, if NULL Select mode is used       */
+    uint16_t           firstBlock;          /*!< First block to be read                        */
+    uint16_t           numBlocks;           /*!< Blocks to be read, 0: up to the memory end    */
+    uint16_t           maxBlocksPerRead;    /*!< Device limit per read, 0: only the link limit */
+    uint8_t            retries;             /*!< Retries of a failed chunk                     */
+    uint8_t           *buf;                 /*!< Output buffer (optional if cb is set)         */
+    uint32_t           bufLen;              /*!< Output buffer length                          */
+    rfalNfcvMemReadCb  cb;                  /*!< Data callback (optional if buf is set)        */
+} rfalNfcvMemReadParam;
+
+
+/*! NFC-V memory write parameters */
+typedef struct
+{
+    uint8_t            flags;               /*!< Request flags, Option set: response on EOF    */
+    uint8_t           *uid;                 /*!< Device UID, if NULL Select mode is used       */
+    uint16_t           firstBlock;          /*!< First block to be written                     */
+    uint16_t           numBlocks;           /*!< Blocks to be written                          */
+    uint8_t            blockLen;            /*!< Block length in bytes                         */
+    uint8_t            maxBlocksPerWrite;   /*!< Device limit per write, 0/1: Write Single Block*/
+    bool               verify;              /*!< Read back and compare once all writes are done*/
+    uint8_t            retries;             /*!< Rewrites of a block failing verification      */
+    const uint8_t     *data;                /*!< Data to be written                            */
+} rfalNfcvMemWriteParam;
+
+
+/*! NFC-V session: commands to a device sent in Selected mode, without UID */
+typedef struct
+{
+    uint8_t   uid[RFAL_NFCV_UID_LEN];       /*!< Device UID                                    */
+    uint8_t   flags;                        /*!< Request flags used on the session commands    */
+    bool      isSelected;                   /*!< Device selected, commands sent without UID    */
+    uint32_t  cmdCnt;                       /*!< Commands sent                                 */
+    uint32_t  txAirtime;                    /*!< Request airtime spent in us                   */
+    uint32_t  savedAirtime;                 /*!< Request airtime saved by not sending the UID  */
+} rfalNfcvSession;
+
+
 /*
 ******************************************************************************
 * GLOBAL FUNCTION PROTOTYPES
@@ -240,6 +400,11 @@ ReturnCode rfalNfcvPollerInventory( rfalNfcvNumSlots nSlots, uint8_t maskLen, ui
  * Once done, the devCnt will indicate how many (if any) devices have
  * been identified and their details are contained on nfcvDevList
  *
+ * At most 16 collisions are tracked, further ones are not resolved and 
+ * ERR_RF_COLLISION is returned along with the devices found. Use 
+ * rfalNfcvPollerInventoryStart()/rfalNfcvPollerInventoryNext() to 
+ * resolve large populations.
+ *
  * \param[in]  devLimit     : device limit value, and size nfcaDevList
  * \param[out] nfcvDevList  : NFC-v listener devices list
  * \param[out] devCnt       : Devices found counter
@@ -248,11 +413,170 @@ ReturnCode rfalNfcvPollerInventory( rfalNfcvNumSlots nSlots, uint8_t maskLen, ui
  * \return ERR_WRONG_STATE  : RFAL not initialized or mode not set
  * \return ERR_PARAM        : Invalid parameters
  * \return ERR_IO           : Generic internal error
+ * \return ERR_RF_COLLISION : Collision(s) left unresolved, devCnt devices found
  * \return ERR_NONE         : No error
  *****************************************************************************
  */
 ReturnCode rfalNfcvPollerCollisionResolution( uint8_t devLimit, rfalNfcvListenDevice *nfcvDevList, uint8_t *devCnt, SPI* mspiChannel, ST25R3911* mST25, DigitalOut* gpio_cs, InterruptIn* IRQ, DigitalOut* fieldLED_01, DigitalOut* fieldLED_02, DigitalOut* fieldLED_03, DigitalOut* fieldLED_04, DigitalOut* fieldLED_05, DigitalOut* fieldLED_06 );
 
+/*!
+ *****************************************************************************
+ * \brief  NFC-V Poller Adaptive Collision Resolution
+ *
+ * Performs a Collision resolution where the number of slots and the mask
+ * depth follow an estimation of the devices population:
+ *  - popHint is the first estimate, the initial mask depth is chosen from it
+ *    skipping the level where every slot would collide
+ *  - masks with few devices expected are resolved with 1 slot INVENTORY_REQs,
+ *    splitting the mask at the collided bit, so no empty slots are spent
+ *  - masks with many devices expected are resolved with 16 slots. At the end
+ *    of each round the devices left on its collided slots are estimated from
+ *    the empty, single and collided slots counts
+ *  - without popHint, a collision on the first 1 slot INVENTORY_REQ opens a
+ *    16 slots round to measure the population
+ *
+ * If earlyStop is set a 16 slots round is ended once the devices found and
+ * estimated on collided slots account for the mask's estimate. Devices on 
+ * the skipped slots are then not identified on this call.
+ *
+ * Runs the inventory iterator (see rfalNfcvPollerInventoryStart()) on an
+ * internal work stack of RFAL_NFCV_ADAPT_MAX_NODES masks
+ *
+ * \param[in]  devLimit     : device limit value, and size nfcvDevList
+ * \param[in]  popHint      : expected number of devices in the field (0 if unknown)
+ * \param[in]  earlyStop    : end 16 slots rounds once the estimate is accounted for
+ * \param[out] nfcvDevList  : NFC-V listener devices list
+ * \param[out] devCnt       : Devices found counter
+ * \param[out] slotCnt      : Number of slots used (optional)
+ *
+ * \return ERR_WRONG_STATE  : RFAL not initialized or mode not set
+ * \return ERR_PARAM        : Invalid parameters
+ * \return ERR_IO           : Generic internal error
+ * \return ERR_RF_COLLISION : Collisions left unresolved, devCnt devices are valid
+ * \return ERR_NONE         : No error
+ *****************************************************************************
+ */
+ReturnCode rfalNfcvPollerCollisionResolutionAdaptive( uint8_t devLimit, uint16_t popHint, bool earlyStop, rfalNfcvListenDevice *nfcvDevList, uint8_t *devCnt, uint16_t *slotCnt, SPI* mspiChannel, ST25R3911* mST25, DigitalOut* gpio_cs, InterruptIn* IRQ, DigitalOut* fieldLED_01, DigitalOut* fieldLED_02, DigitalOut* fieldLED_03, DigitalOut* fieldLED_04, DigitalOut* fieldLED_05, DigitalOut* fieldLED_06 );
+
+/*!
+ *****************************************************************************
+ * \brief  NFC-V Poller Inventory Start
+ *
+ * Initializes an inventory iterator performing the adaptive Collision 
+ * resolution (see rfalNfcvPollerCollisionResolutionAdaptive()) on a caller
+ * provided work stack of mask prefixes. No frame is sent by this call.
+ *
+ * The stack bounds the number of pending masks, not the number of devices.
+ * A stack of RFAL_NFCV_COLL_STACK_LEN never drops a mask; a shorter one may, 
+ * in which case rfalNfcvPollerInventoryNext() ends with ERR_RF_COLLISION.
+ * The initial mask depth from popHint is only applied if the stack holds
+ * at least 16 masks.
+ *
+ * \param[out] it           : inventory iterator
+ * \param[in]  stack        : work stack, must be kept valid during the iteration
+ * \param[in]  stackLen     : work stack length, at least RFAL_NFCV_COLL_STACK_LEN_MIN
+ * \param[in]  popHint      : expected number of devices in the field (0 if unknown)
+ * \param[in]  earlyStop    : end 16 slots rounds once the estimate is accounted for
+ *
+ * \return ERR_PARAM        : Invalid parameters
+ * \return ERR_NONE         : No error
+ *****************************************************************************
+ */
+ReturnCode rfalNfcvPollerInventoryStart( rfalNfcvInventoryIt *it, rfalNfcvCollision *stack, uint16_t stackLen, uint16_t popHint, bool earlyStop );
+
+/*!
+ *****************************************************************************
+ * \brief  NFC-V Poller Inventory Next
+ *
+ * Continues the Collision resolution of the given iterator until the next
+ * device is resolved, returning it as soon as its INVENTORY_RES is received.
+ *
+ * When a device is returned in the middle of a 16 slots round, the round 
+ * is resumed on the following call. No other frame may be sent in between
+ * (e.g. SLPV_REQ), as it would end the round on the VICCs.
+ *
+ * \param[in]  it           : inventory iterator
+ * \param[out] nfcvDev      : resolved NFC-V listener device
+ *
+ * \return ERR_WRONG_STATE  : RFAL not initialized or mode not set
+ * \return ERR_PARAM        : Invalid parameters
+ * \return ERR_TIMEOUT      : Inventory done, no more devices
+ * \return ERR_RF_COLLISION : Inventory done, collisions left unresolved
+ * \return ERR_NONE         : Device resolved
+ *****************************************************************************
+ */
+ReturnCode rfalNfcvPollerInventoryNext( rfalNfcvInventoryIt *it, rfalNfcvListenDevice *nfcvDev, SPI* mspiChannel, ST25R3911* mST25, DigitalOut* gpio_cs, InterruptIn* IRQ, DigitalOut* fieldLED_01, DigitalOut* fieldLED_02, DigitalOut* fieldLED_03, DigitalOut* fieldLED_04, DigitalOut* fieldLED_05, DigitalOut* fieldLED_06 );
+
+/*!
+ *****************************************************************************
+ * \brief  NFC-V Population Initialize
+ *
+ * Initializes a population tracker on a caller provided hash table. 
+ * The table should be kept at least a third larger than the expected
+ * number of devices.
+ *
+ * \param[out] pop          : population tracker
+ * \param[in]  entries      : hash table, must be kept valid while in use
+ * \param[in]  entriesLen   : hash table length
+ * \param[in]  checkPeriod  : presence check period in ms (0: on every update)
+ * \param[in]  evtCb        : arrival/departure callback (optional)
+ *
+ * \return ERR_PARAM        : Invalid parameters
+ * \return ERR_NONE         : No error
+ *****************************************************************************
+ */
+ReturnCode rfalNfcvPopulationInitialize( rfalNfcvPopulation *pop, rfalNfcvPopEntry *entries, uint16_t entriesLen, uint32_t checkPeriod, rfalNfcvPopEventCb evtCb );
+
+/*!
+ *****************************************************************************
+ * \brief  NFC-V Population Update
+ *
+ * Performs one tracking cycle:
+ *  - once the check period elapsed, the presence of each known device is
+ *    checked with an addressed command (answered also in Quiet state). 
+ *    A device missing RFAL_NFCV_POP_MISS_MAX consecutive checks is removed
+ *    and reported as departed
+ *  - an inventory is performed, where only devices not in Quiet state 
+ *    answer. Unknown devices are added and reported as arrived
+ *  - every known device not yet in Quiet state is sent a SLPV_REQ
+ *
+ * The work is thus proportional to the changes on the field rather than to
+ * the number of devices. 
+ * A field reset returns every device to Ready state, in this case 
+ * rfalNfcvPopulationResetToReady() should be called to keep track of it.
+ *
+ * \param[in]  pop          : population tracker
+ * \param[out] newCnt       : number of devices arrived (optional)
+ *
+ * \return ERR_WRONG_STATE  : RFAL not initialized or mode not set
+ * \return ERR_PARAM        : Invalid parameters
+ * \return ERR_NOMEM        : Hash table full, some devices were not added
+ * \return ERR_RF_COLLISION : Collisions left unresolved on the inventory
+ * \return ERR_NONE         : No error
+ *****************************************************************************
+ */
+ReturnCode rfalNfcvPopulationUpdate( rfalNfcvPopulation *pop, uint16_t *newCnt, SPI* mspiChannel, ST25R3911* mST25, DigitalOut* gpio_cs, InterruptIn* IRQ, DigitalOut* fieldLED_01, DigitalOut* fieldLED_02, DigitalOut* fieldLED_03, DigitalOut* fieldLED_04, DigitalOut* fieldLED_05, DigitalOut* fieldLED_06 );
+
+/*!
+ *****************************************************************************
+ * \brief  NFC-V Population Reset To Ready
+ *
+ * Sends a non addressed Reset To Ready, returning all devices to Ready
+ * state, and marks all known devices as not Quiet. They are put back to
+ * Quiet state on the next update without being reported again.
+ * It may also be called with no frame sent (sendCmd false) after a field
+ * reset to only update the tracking.
+ *
+ * \param[in]  pop          : population tracker
+ * \param[in]  sendCmd      : send the Reset To Ready command
+ *
+ * \return ERR_WRONG_STATE  : RFAL not initialized or mode not set
+ * \return ERR_PARAM        : Invalid parameters
+ * \return ERR_NONE         : No error
+ *****************************************************************************
+ */
+ReturnCode rfalNfcvPopulationResetToReady( rfalNfcvPopulation *pop, bool sendCmd, SPI* mspiChannel, ST25R3911* mST25, DigitalOut* gpio_cs, InterruptIn* IRQ, DigitalOut* fieldLED_01, DigitalOut* fieldLED_02, DigitalOut* fieldLED_03, DigitalOut* fieldLED_04, DigitalOut* fieldLED_05, DigitalOut* fieldLED_06 );
+
 /*!
  *****************************************************************************
  * \brief  NFC-V Poller Sleep
@@ -372,6 +696,322 @@ ReturnCode rfalNfvPollerWriteSingleBlock( uint8_t flags, uint8_t* uid, uint8_t b
  */
 ReturnCode rfalNfvPollerReadMultipleBlocks( uint8_t flags, uint8_t* uid, uint8_t firstBlockNum, uint8_t numOfBlocks, uint8_t* rxBuf, uint16_t rxBufLen, uint16_t *rcvLen, SPI* mspiChannel, ST25R3911* mST25, DigitalOut* gpio_cs, InterruptIn* IRQ, DigitalOut* fieldLED_01, DigitalOut* fieldLED_02, DigitalOut* fieldLED_03, DigitalOut* fieldLED_04, DigitalOut* fieldLED_05, DigitalOut* fieldLED_06 );
 
+
+/*!
+ *****************************************************************************
+ * \brief  NFC-V Poller Reset To Ready
+ *
+ * Returns a device (VICC) to Ready state, e.g. out of Quiet state
+ *
+ * \param[in]  flags        : Flags to be used: Sub-carrier; Data_rate; Option
+ *                            for NFC-Forum use: RFAL_NFCV_REQ_FLAG_DEFAULT
+ * \param[in]  uid          : UID of the device to be reset
+ *                            if not provided all devices are reset and no 
+ *                            response is expected
+ *
+ * \return ERR_WRONG_STATE  : RFAL not initialized or incorrect mode
+ * \return ERR_PARAM        : Invalid parameters
+ * \return ERR_IO           : Generic internal error
+ * \return ERR_CRC          : CRC error detected
+ * \return ERR_FRAMING      : Framing error detected
+ * \return ERR_PROTO        : Protocol error detected
+ * \return ERR_TIMEOUT      : Timeout error
+ * \return ERR_NONE         : No error
+ *****************************************************************************
+ */
+ReturnCode rfalNfvResetToReady( uint8_t flags, uint8_t* uid, SPI* mspiChannel, ST25R3911* mST25, DigitalOut* gpio_cs, InterruptIn* IRQ, DigitalOut* fieldLED_01, DigitalOut* fieldLED_02, DigitalOut* fieldLED_03, DigitalOut* fieldLED_04, DigitalOut* fieldLED_05, DigitalOut* fieldLED_06 );
+
+/*!
+ *****************************************************************************
+ * \brief  NFC-V Poller Set Fast Mode
+ *
+ * Enables the fast custom command variants, whose responses are sent at
+ * 53kbps (fc/256) doubling the data rate of bulk reads. Once enabled 
+ * rfalNfvReadSingleBlock() and rfalNfvReadMultipleBlocks() use them.
+ *
+ * A device not answering or reporting the command as not supported is
+ * retried with the standard command, and is not sent fast commands again
+ * until the next call to this function.
+ *
+ * \param[in]  enable       : enable/disable the fast commands
+ * \param[in]  mfgCode      : IC Manufacturer code sent on custom commands
+ *                            e.g. RFAL_NFCV_MFG_CODE_ST
+ *
+ * \return ERR_NONE         : No error
+ *****************************************************************************
+ */
+ReturnCode rfalNfcvPollerSetFastMode( bool enable, uint8_t mfgCode );
+
+/*!
+ *****************************************************************************
+ * \brief  NFC-V Poller Initiate
+ *
+ * Sends the non addressed Initiate command, after which devices answer 
+ * Fast Inventory Initiated
+ *
+ * \param[in]  flags        : Flags to be used: Sub-carrier; Data_rate; Option
+ *                            for NFC-Forum use: RFAL_NFCV_REQ_FLAG_DEFAULT
+ *
+ * \return ERR_WRONG_STATE  : RFAL not initialized or incorrect mode
+ * \return ERR_IO           : Generic internal error
+ * \return ERR_NONE         : No error
+ *****************************************************************************
+ */
+ReturnCode rfalNfvInitiate( uint8_t flags, SPI* mspiChannel, ST25R3911* mST25, DigitalOut* gpio_cs, InterruptIn* IRQ, DigitalOut* fieldLED_01, DigitalOut* fieldLED_02, DigitalOut* fieldLED_03, DigitalOut* fieldLED_04, DigitalOut* fieldLED_05, DigitalOut* fieldLED_06 );
+
+/*!
+ *****************************************************************************
+ * \brief  NFC-V Poller Fast Inventory
+ *
+ * Performs an 1 slot Inventory with Initiate and Fast Inventory Initiated, 
+ * the INVENTORY_RES being received at 53kbps (fc/256).
+ * Without fast mode or if no device answers the standard INVENTORY_REQ
+ * is used instead.
+ *
+ * \param[in]  maskLen      : Number of bits of the mask
+ * \param[in]  maskVal      : Mask value
+ * \param[out] invRes       : INVENTORY_RES
+ * \param[out] rcvdLen      : number of bits received (optional)
+ *
+ * \return ERR_WRONG_STATE  : RFAL not initialized or incorrect mode
+ * \return ERR_PARAM        : Invalid parameters
+ * \return ERR_IO           : Generic internal error
+ * \return ERR_RF_COLLISION : Collision detected
+ * \return ERR_CRC          : CRC error detected
+ * \return ERR_PROTO        : Protocol error detected
+ * \return ERR_TIMEOUT      : Timeout error
+ * \return ERR_NONE         : No error
+ *****************************************************************************
+ */
+ReturnCode rfalNfcvPollerFastInventory( uint8_t maskLen, uint8_t *maskVal, rfalNfcvInventoryRes *invRes, uint16_t* rcvdLen, SPI* mspiChannel, ST25R3911* mST25, DigitalOut* gpio_cs, InterruptIn* IRQ, DigitalOut* fieldLED_01, DigitalOut* fieldLED_02, DigitalOut* fieldLED_03, DigitalOut* fieldLED_04, DigitalOut* fieldLED_05, DigitalOut* fieldLED_06 );
+
+/*!
+ *****************************************************************************
+ * \brief  NFC-V Poller Get System Information
+ *
+ * Retrieves the System Information of a device (VICC). If the memory size
+ * cannot be represented (256 blocks or more) the Extended Get System 
+ * Information is used, when supported by the device. If the extended 
+ * request fails or its response is malformed the standard information 
+ * is kept. sysInfo is only written with a well formed response.
+ *
+ * \param[in]  flags        : Flags to be used: Sub-carrier; Data_rate; Option
+ *                            for NFC-Forum use: RFAL_NFCV_REQ_FLAG_DEFAULT
+ * \param[in]  uid          : UID of the device
+ *                            if not provided Select mode will be used
+ * \param[out] sysInfo      : parsed System Information
+ *
+ * \return ERR_WRONG_STATE  : RFAL not initialized or incorrect mode
+ * \return ERR_PARAM        : Invalid parameters
+ * \return ERR_IO           : Generic internal error
+ * \return ERR_CRC          : CRC error detected
+ * \return ERR_FRAMING      : Framing error detected
+ * \return ERR_PROTO        : Protocol error detected
+ * \return ERR_TIMEOUT      : Timeout error
+ * \return ERR_NONE         : No error
+ *****************************************************************************
+ */
+ReturnCode rfalNfvGetSystemInformation( uint8_t flags, uint8_t* uid, rfalNfcvSystemInfo *sysInfo, SPI* mspiChannel, ST25R3911* mST25, DigitalOut* gpio_cs, InterruptIn* IRQ, DigitalOut* fieldLED_01, DigitalOut* fieldLED_02, DigitalOut* fieldLED_03, DigitalOut* fieldLED_04, DigitalOut* fieldLED_05, DigitalOut* fieldLED_06 );
+
+/*!
+ *****************************************************************************
+ * \brief  NFC-V Poller Read Memory
+ *
+ * Reads a range of blocks, or the whole memory, of a device (VICC).
+ * The block size and count are retrieved with Get System Information, 
+ * and the range is read with Read Multiple Blocks chunks as large as the
+ * link (RFAL_NFCV_READ_MAX_DATA_LEN) and param->maxBlocksPerRead allow.
+ * Extended commands are used above block 255, fast ones if enabled by 
+ * rfalNfcvPollerSetFastMode().
+ *
+ * The next request is computed while a response is being received, each
+ * chunk is delivered once received: a response may exceed the FIFO so the
+ * reception is serviced throughout. A failed chunk is retried up to
+ * param->retries times without restarting the read.
+ * The data is written to param->buf and/or given to param->cb
+ *
+ * \param[in]  param        : read parameters
+ * \param[out] sysInfo      : System Information of the device (optional)
+ * \param[out] rcvdLen      : number of data bytes read (optional)
+ *
+ * \return ERR_WRONG_STATE  : RFAL not initialized or incorrect mode
+ * \return ERR_PARAM        : Invalid parameters
+ * \return ERR_NOMEM        : param->buf too small for the range
+ * \return ERR_NOTSUPP      : Memory size not available on the device
+ * \return ERR_CRC          : CRC error detected, retries exhausted
+ * \return ERR_PROTO        : Protocol error detected, retries exhausted
+ * \return ERR_TIMEOUT      : Timeout error, retries exhausted
+ * \return ERR_NONE         : No error
+ *****************************************************************************
+ */
+ReturnCode rfalNfcvPollerReadMemory( const rfalNfcvMemReadParam *param, rfalNfcvSystemInfo *sysInfo, uint32_t *rcvdLen, SPI* mspiChannel, ST25R3911* mST25, DigitalOut* gpio_cs, InterruptIn* IRQ, DigitalOut* fieldLED_01, DigitalOut* fieldLED_02, DigitalOut* fieldLED_03, DigitalOut* fieldLED_04, DigitalOut* fieldLED_05, DigitalOut* fieldLED_06 );
+
+/*!
+ *****************************************************************************
+ * \brief  NFC-V Poller Write Multiple Blocks
+ *
+ * Writes consecutive blocks of a device (VICC) in a single command, saving
+ * the request turnaround and write time of each block. Extended Write 
+ * Multiple Blocks is used when the last block written is above 255.
+ *
+ * If the Option flag is set the device answers only once it receives an
+ * EOF, which is sent after the write time (e.g. TI devices require it). 
+ * Without it (ST, NXP) the response is awaited up to the write time.
+ *
+ * \param[in]  flags        : Flags to be used: Sub-carrier; Data_rate; Option
+ *                            for NFC-Forum use: RFAL_NFCV_REQ_FLAG_DEFAULT
+ * \param[in]  uid          : UID of the device to be written
+ *                            if not provided Select mode will be used
+ * \param[in]  firstBlockNum: Number of the first block to write
+ * \param[in]  numOfBlocks  : Number of blocks to write (not encoded minus one)
+ * \param[in]  wrData       : data to be written, numOfBlocks * blockLen bytes
+ * \param[in]  blockLen     : number of bytes of a block
+ *
+ * \return ERR_WRONG_STATE  : RFAL not initialized or incorrect mode
+ * \return ERR_PARAM        : Invalid parameters
+ * \return ERR_IO           : Generic internal error
+ * \return ERR_CRC          : CRC error detected
+ * \return ERR_FRAMING      : Framing error detected
+ * \return ERR_PROTO        : Protocol error detected
+ * \return ERR_WRITE        : Write failed on the device
+ * \return ERR_TIMEOUT      : Timeout error
+ * \return ERR_NONE         : No error
+ *****************************************************************************
+ */
+ReturnCode rfalNfvWriteMultipleBlocks( uint8_t flags, uint8_t* uid, uint16_t firstBlockNum, uint8_t numOfBlocks, const uint8_t* wrData, uint8_t blockLen, SPI* mspiChannel, ST25R3911* mST25, DigitalOut* gpio_cs, InterruptIn* IRQ, DigitalOut* fieldLED_01, DigitalOut* fieldLED_02, DigitalOut* fieldLED_03, DigitalOut* fieldLED_04, DigitalOut* fieldLED_05, DigitalOut* fieldLED_06 );
+
+/*!
+ *****************************************************************************
+ * \brief  NFC-V Poller Write Memory
+ *
+ * Writes a range of blocks of a device (VICC) with Write Multiple Blocks 
+ * of up to param->maxBlocksPerWrite blocks (RFAL_NFCV_WRITE_MAX_DATA_LEN).
+ * A param->maxBlocksPerWrite of 0 is treated as 1 (Write Single Block).
+ * Extended commands are used for the whole range, writes and read back, 
+ * when its last block is above 255.
+ *
+ * If param->verify is set, the range is read back once all writes are 
+ * done, in Read Multiple Blocks as large as the link allows, instead of 
+ * alternating writes and reads. Only the blocks differing are rewritten,
+ * up to param->retries times.
+ *
+ * \param[in]  param        : write parameters
+ *
+ * \return ERR_WRONG_STATE  : RFAL not initialized or incorrect mode
+ * \return ERR_PARAM        : Invalid parameters
+ * \return ERR_WRITE        : Data still differs after the retries
+ * \return ERR_PROTO        : Protocol error detected
+ * \return ERR_TIMEOUT      : Timeout error
+ * \return ERR_NONE         : No error
+ *****************************************************************************
+ */
+ReturnCode rfalNfcvPollerWriteMemory( const rfalNfcvMemWriteParam *param, SPI* mspiChannel, ST25R3911* mST25, DigitalOut* gpio_cs, InterruptIn* IRQ, DigitalOut* fieldLED_01, DigitalOut* fieldLED_02, DigitalOut* fieldLED_03, DigitalOut* fieldLED_04, DigitalOut* fieldLED_05, DigitalOut* fieldLED_06 );
+
+/*!
+ *****************************************************************************
+ * \brief  NFC-V Session Open
+ *
+ * Selects the device once, so that the session commands are sent with 
+ * the Select flag and without the UID (8 bytes less per request).
+ * If the Select fails the session is kept in Addressed mode.
+ *
+ * Only one device can be Selected at a time: opening a session on another
+ * device returns the previous one to Ready state, its session then falls
+ * back to Addressed mode on its next command.
+ *
+ * \param[out] session      : session
+ * \param[in]  flags        : Flags to be used: Sub-carrier; Data_rate; Option
+ *                            for NFC-Forum use: RFAL_NFCV_REQ_FLAG_DEFAULT
+ * \param[in]  uid          : UID of the device
+ *
+ * \return ERR_WRONG_STATE  : RFAL not initialized or incorrect mode
+ * \return ERR_PARAM        : Invalid parameters
+ * \return ERR_NONE         : No error
+ *****************************************************************************
+ */
+ReturnCode rfalNfcvSessionOpen( rfalNfcvSession *session, uint8_t flags, const uint8_t* uid, SPI* mspiChannel, ST25R3911* mST25, DigitalOut* gpio_cs, InterruptIn* IRQ, DigitalOut* fieldLED_01, DigitalOut* fieldLED_02, DigitalOut* fieldLED_03, DigitalOut* fieldLED_04, DigitalOut* fieldLED_05, DigitalOut* fieldLED_06 );
+
+/*!
+ *****************************************************************************
+ * \brief  NFC-V Session Close
+ *
+ * Returns a Selected device to Ready state
+ *
+ * \param[in]  session      : session
+ *
+ * \return ERR_WRONG_STATE  : RFAL not initialized or incorrect mode
+ * \return ERR_PARAM        : Invalid parameters
+ * \return ERR_TIMEOUT      : Timeout error
+ * \return ERR_NONE         : No error
+ *****************************************************************************
+ */
+ReturnCode rfalNfcvSessionClose( rfalNfcvSession *session, SPI* mspiChannel, ST25R3911* mST25, DigitalOut* gpio_cs, InterruptIn* IRQ, DigitalOut* fieldLED_01, DigitalOut* fieldLED_02, DigitalOut* fieldLED_03, DigitalOut* fieldLED_04, DigitalOut* fieldLED_05, DigitalOut* fieldLED_06 );
+
+/*!
+ *****************************************************************************
+ * \brief  NFC-V Session Read Single Block
+ *
+ * Same as rfalNfvReadSingleBlock() on the session device. A command not
+ * answered in Selected mode is retried in Addressed mode, which is kept
+ * afterwards.
+ *
+ * \return see rfalNfvReadSingleBlock()
+ *****************************************************************************
+ */
+ReturnCode rfalNfcvSessionReadSingleBlock( rfalNfcvSession *session, uint8_t blockNum, uint8_t* rxBuf, uint16_t rxBufLen, uint16_t *rcvLen, SPI* mspiChannel, ST25R3911* mST25, DigitalOut* gpio_cs, InterruptIn* IRQ, DigitalOut* fieldLED_01, DigitalOut* fieldLED_02, DigitalOut* fieldLED_03, DigitalOut* fieldLED_04, DigitalOut* fieldLED_05, DigitalOut* fieldLED_06 );
+
+/*!
+ *****************************************************************************
+ * \brief  NFC-V Session Write Single Block
+ *
+ * Same as rfalNfvWriteSingleBlock() on the session device, with fallback
+ * to Addressed mode (see rfalNfcvSessionReadSingleBlock())
+ *
+ * \return see rfalNfvWriteSingleBlock()
+ *****************************************************************************
+ */
+ReturnCode rfalNfcvSessionWriteSingleBlock( rfalNfcvSession *session, uint8_t blockNum, uint8_t* wrData, uint8_t blockLen, SPI* mspiChannel, ST25R3911* mST25, DigitalOut* gpio_cs, InterruptIn* IRQ, DigitalOut* fieldLED_01, DigitalOut* fieldLED_02, DigitalOut* fieldLED_03, DigitalOut* fieldLED_04, DigitalOut* fieldLED_05, DigitalOut* fieldLED_06 );
+
+/*!
+ *****************************************************************************
+ * \brief  NFC-V Session Read Multiple Blocks
+ *
+ * Same as rfalNfvReadMultipleBlocks() on the session device, with fallback
+ * to Addressed mode (see rfalNfcvSessionReadSingleBlock())
+ *
+ * \return see rfalNfvReadMultipleBlocks()
+ *****************************************************************************
+ */
+ReturnCode rfalNfcvSessionReadMultipleBlocks( rfalNfcvSession *session, uint8_t firstBlockNum, uint8_t numOfBlocks, uint8_t* rxBuf, uint16_t rxBufLen, uint16_t *rcvLen, SPI* mspiChannel, ST25R3911* mST25, DigitalOut* gpio_cs, InterruptIn* IRQ, DigitalOut* fieldLED_01, DigitalOut* fieldLED_02, DigitalOut* fieldLED_03, DigitalOut* fieldLED_04, DigitalOut* fieldLED_05, DigitalOut* fieldLED_06 );
+
+/*!
+ *****************************************************************************
+ * \brief  NFC-V Session Write Multiple Blocks
+ *
+ * Same as rfalNfvWriteMultipleBlocks() on the session device, with fallback
+ * to Addressed mode (see rfalNfcvSessionReadSingleBlock())
+ *
+ * \return see rfalNfvWriteMultipleBlocks()
+ *****************************************************************************
+ */
+ReturnCode rfalNfcvSessionWriteMultipleBlocks( rfalNfcvSession *session, uint16_t firstBlockNum, uint8_t numOfBlocks, const uint8_t* wrData, uint8_t blockLen, SPI* mspiChannel, ST25R3911* mST25, DigitalOut* gpio_cs, InterruptIn* IRQ, DigitalOut* fieldLED_01, DigitalOut* fieldLED_02, DigitalOut* fieldLED_03, DigitalOut* fieldLED_04, DigitalOut* fieldLED_05, DigitalOut* fieldLED_06 );
+
+/*!
+ *****************************************************************************
+ * \brief  NFC-V Request Airtime
+ *
+ * Computes the time to transmit a request of the given length with the
+ * current VCD coding (1 out of 4 or 1 out of 256), including SOF, CRC 
+ * and EOF. Used by the session statistics to compare the Addressed and 
+ * Selected modes.
+ *
+ * \param[in]  reqLen       : request length in bytes, without CRC
+ *
+ * \return request airtime in us
+ *****************************************************************************
+ */
+uint32_t rfalNfcvGetRequestAirtime( uint16_t reqLen );
+
 ReturnCode rfalNfvSelect( uint8_t flags, uint8_t* uid, SPI* mspiChannel, ST25R3911* mST25, DigitalOut* gpio_cs, InterruptIn* IRQ, DigitalOut* fieldLED_01, DigitalOut* fieldLED_02, DigitalOut* fieldLED_03, DigitalOut* fieldLED_04, DigitalOut* fieldLED_05, DigitalOut* fieldLED_06 );
 ReturnCode rfalNfvReadSingleBlock( uint8_t flags, uint8_t* uid, uint8_t blockNum, uint8_t* rxBuf, uint16_t rxBufLen, uint16_t *rcvLen, SPI* mspiChannel, ST25R3911* mST25, DigitalOut* gpio_cs, InterruptIn* IRQ, DigitalOut* fieldLED_01, DigitalOut* fieldLED_02, DigitalOut* fieldLED_03, DigitalOut* fieldLED_04, DigitalOut* fieldLED_05, DigitalOut* fieldLED_06 );
 ReturnCode rfalNfvWriteSingleBlock( uint8_t flags, uint8_t* uid, uint8_t blockNum, uint8_t* wrData, uint8_t blockLen, SPI* mspiChannel, ST25R3911* mST25, DigitalOut* gpio_cs, InterruptIn* IRQ, DigitalOut* fieldLED_01, DigitalOut* fieldLED_02, DigitalOut* fieldLED_03, DigitalOut* fieldLED_04, DigitalOut* fieldLED_05, DigitalOut* fieldLED_06 );
@@ -73,6 +73,9 @@ typedef struct{
     bool                    rxse;        /*!< Flag indicating if RXE was received with RXS        */
     
     rfalTransceiveContext   ctx;         /*!< The transceive context given by the caller          */
+    
+    const rfalTransceiveSegment *txSeg;  /*!< Outgoing segments list, NULL if ctx.txBuf is used   */
+    uint8_t                 txSegCnt;    /*!< Number of segments on txSeg                         */
 } rfalTxRx;
 
 
@@ -135,7 +138,8 @@ typedef struct{
 } rfalConfigs;
 
 
-/*! Struct that holds NFC-F data - Used only inside rfalFelicaPoll() (static to avoid adding it into stack) */
+/*! Struct that holds NFC-F data - Used only inside rfalFelicaPoll() (static to avoid adding it into stack) *
+ *  rfalFeliCaPollStream() only uses the first two entries, alternating between them                     */
 typedef struct{    
     rfalFeliCaPollRes pollResponses[RFAL_FELICA_POLL_MAX_SLOTS];   /* FeliCa Poll response container for 16 slots */
 } rfalNfcfWorkingData;
@@ -364,12 +368,16 @@ static rfal gRFAL;              /*!< RFAL module instance               */
 static void rfalTransceiveTx( SPI* mspiChannel, ST25R3911* mST25, DigitalOut* gpio_cs, InterruptIn* IRQ, DigitalOut* fieldLED_01, DigitalOut* fieldLED_02, DigitalOut* fieldLED_03, DigitalOut* fieldLED_04, DigitalOut* fieldLED_05, DigitalOut* fieldLED_06 );
 static void rfalTransceiveRx( SPI* mspiChannel, ST25R3911* mST25, DigitalOut* gpio_cs, InterruptIn* IRQ, DigitalOut* fieldLED_01, DigitalOut* fieldLED_02, DigitalOut* fieldLED_03, DigitalOut* fieldLED_04, DigitalOut* fieldLED_05, DigitalOut* fieldLED_06 );
 static ReturnCode rfalTransceiveRunBlockingTx( SPI* mspiChannel, ST25R3911* mST25, DigitalOut* gpio_cs, InterruptIn* IRQ, DigitalOut* fieldLED_01, DigitalOut* fieldLED_02, DigitalOut* fieldLED_03, DigitalOut* fieldLED_04, DigitalOut* fieldLED_05, DigitalOut* fieldLED_06 );
+static void rfalTransceiveWriteFifo( uint16_t offset, uint16_t len, SPI* mspiChannel, ST25R3911* mST25, DigitalOut* gpio_cs, InterruptIn* IRQ, DigitalOut* fieldLED_01, DigitalOut* fieldLED_02, DigitalOut* fieldLED_03, DigitalOut* fieldLED_04, DigitalOut* fieldLED_05, DigitalOut* fieldLED_06 );
 static void rfalPrepareTransceive( SPI* mspiChannel, ST25R3911* mST25, DigitalOut* gpio_cs, InterruptIn* IRQ, DigitalOut* fieldLED_01, DigitalOut* fieldLED_02, DigitalOut* fieldLED_03, DigitalOut* fieldLED_04, DigitalOut* fieldLED_05, DigitalOut* fieldLED_06 );
 static void rfalCleanupTransceive( SPI* mspiChannel, ST25R3911* mST25, DigitalOut* gpio_cs, InterruptIn* IRQ, DigitalOut* fieldLED_01, DigitalOut* fieldLED_02, DigitalOut* fieldLED_03, DigitalOut* fieldLED_04, DigitalOut* fieldLED_05, DigitalOut* fieldLED_06 );
 static void rfalErrorHandling( ST25R3911* mST25, SPI * mspiChannel, DigitalOut* gpio_cs, InterruptIn* IRQ, DigitalOut* fieldLED_01, DigitalOut* fieldLED_02, DigitalOut* fieldLED_03, DigitalOut* fieldLED_04, DigitalOut* fieldLED_05, DigitalOut* fieldLED_06 );
 static ReturnCode rfalRunTransceiveWorker( SPI* mspiChannel, ST25R3911* mST25, DigitalOut* gpio_cs, InterruptIn* IRQ, DigitalOut* fieldLED_01, DigitalOut* fieldLED_02, DigitalOut* fieldLED_03, DigitalOut* fieldLED_04, DigitalOut* fieldLED_05, DigitalOut* fieldLED_06 );
 static ReturnCode rfalRunListenModeWorker( SPI* mspiChannel, ST25R3911* mST25, DigitalOut* gpio_cs, InterruptIn* IRQ, DigitalOut* fieldLED_01, DigitalOut* fieldLED_02, DigitalOut* fieldLED_03, DigitalOut* fieldLED_04, DigitalOut* fieldLED_05, DigitalOut* fieldLED_06 );
 static void rfalRunWakeUpModeWorker( SPI* mspiChannel, ST25R3911* mST25, DigitalOut* gpio_cs, InterruptIn* IRQ, DigitalOut* fieldLED_01, DigitalOut* fieldLED_02, DigitalOut* fieldLED_03, DigitalOut* fieldLED_04, DigitalOut* fieldLED_05, DigitalOut* fieldLED_06 );
+#if RFAL_FEATURE_NFCF
+static ReturnCode rfalFeliCaPollRun( rfalFeliCaPollSlots slots, uint16_t sysCode, uint8_t reqCode, rfalFeliCaPollRes* rxBufs, uint8_t rxBufsCnt, rfalFeliCaPollResCallback resCb, uint8_t *devicesDetected, uint8_t *collisionsDetected, SPI* mspiChannel, ST25R3911* mST25, DigitalOut* gpio_cs, InterruptIn* IRQ, DigitalOut* fieldLED_01, DigitalOut* fieldLED_02, DigitalOut* fieldLED_03, DigitalOut* fieldLED_04, DigitalOut* fieldLED_05, DigitalOut* fieldLED_06 );
+#endif /* RFAL_FEATURE_NFCF */
 
 static void rfalFIFOStatusUpdate( ST25R3911* mST25, SPI * mspiChannel, DigitalOut* gpio_cs, InterruptIn* IRQ, DigitalOut* fieldLED_01, DigitalOut* fieldLED_02, DigitalOut* fieldLED_03, DigitalOut* fieldLED_04, DigitalOut* fieldLED_05, DigitalOut* fieldLED_06 );
 static void rfalFIFOStatusClear( void );
@@ -1121,7 +1129,9 @@ ReturnCode rfalStartTransceive( rfalTransceiveContext *ctx,SPI* mspiChannel, ST2
             return ERR_WRONG_STATE;
         }
         
-        gRFAL.TxRx.ctx = *ctx;
+        gRFAL.TxRx.ctx      = *ctx;
+        gRFAL.TxRx.txSeg    = NULL;
+        gRFAL.TxRx.txSegCnt = 0;
         
         /*******************************************************************************/
         if( gRFAL.timings.FDTListen != RFAL_TIMING_NONE )
@@ -1229,6 +1239,62 @@ ReturnCode rfalStartTransceive( rfalTransceiveContext *ctx,SPI* mspiChannel, ST2
 }
 
 
+/*******************************************************************************/
+ReturnCode rfalStartTransceiveSegments( rfalTransceiveContext *ctx, const rfalTransceiveSegment *txSeg, uint8_t txSegCnt, SPI* mspiChannel, ST25R3911* mST25, DigitalOut* gpio_cs, InterruptIn* IRQ, DigitalOut* fieldLED_01, DigitalOut* fieldLED_02, DigitalOut* fieldLED_03, DigitalOut* fieldLED_04, DigitalOut* fieldLED_05, DigitalOut* fieldLED_06 )
+{
+    ReturnCode            ret;
+    rfalTransceiveContext segCtx;
+    const uint8_t*        firstBuf;
+    uint32_t              totalLen;
+    uint8_t               i;
+    
+    if( (ctx == NULL) || (txSeg == NULL) || (txSegCnt == 0) )
+    {
+        return ERR_PARAM;
+    }
+    
+    /* NFC-V/PicoPass codes the whole message from a single buffer */
+    if( (RFAL_MODE_POLL_NFCV == gRFAL.mode) || (RFAL_MODE_POLL_PICOPASS == gRFAL.mode) )
+    {
+        return ERR_NOTSUPP;
+    }
+    
+    /* Calculate the total message length, ensuring it fits the bit length used by the context */
+    totalLen = 0;
+    firstBuf = NULL;
+    for( i = 0; i < txSegCnt; i++ )
+    {
+        if( (txSeg[i].buf == NULL) && (txSeg[i].len > 0) )
+        {
+            return ERR_PARAM;
+        }
+        
+        if( (firstBuf == NULL) && (txSeg[i].len > 0) )
+        {
+            firstBuf = txSeg[i].buf;
+        }
+        totalLen += txSeg[i].len;
+    }
+    
+    if( rfalConvBytesToBits(totalLen) > 0xFFFF )
+    {
+        return ERR_PARAM;
+    }
+    
+    /* txBuf only signals that a Tx is to be performed, data is fetched from the segments */
+    segCtx          = *ctx;
+    segCtx.txBuf    = (uint8_t*)firstBuf;
+    segCtx.txBufLen = (uint16_t)rfalConvBytesToBits(totalLen);
+    
+    EXIT_ON_ERR( ret, rfalStartTransceive( &segCtx, mspiChannel, mST25, gpio_cs, IRQ, fieldLED_01, fieldLED_02, fieldLED_03, fieldLED_04, fieldLED_05, fieldLED_06 ) );
+    
+    gRFAL.TxRx.txSeg    = txSeg;
+    gRFAL.TxRx.txSegCnt = txSegCnt;
+    
+    return ERR_NONE;
+}
+
+
 /*******************************************************************************/
 ReturnCode rfalTransceiveBlockingTx( uint8_t* txBuf, uint16_t txBufLen, uint8_t* rxBuf, uint16_t rxBufLen, uint16_t* actLen, uint32_t flags, uint32_t fwt, SPI* mspiChannel, ST25R3911* mST25, DigitalOut* gpio_cs, InterruptIn* IRQ, DigitalOut* fieldLED_01, DigitalOut* fieldLED_02, DigitalOut* fieldLED_03, DigitalOut* fieldLED_04, DigitalOut* fieldLED_05, DigitalOut* fieldLED_06 )
 {
@@ -1242,6 +1308,19 @@ ReturnCode rfalTransceiveBlockingTx( uint8_t* txBuf, uint16_t txBufLen, uint8_t*
 }
 
 
+/*******************************************************************************/
+ReturnCode rfalTransceiveBlockingTxSegments( const rfalTransceiveSegment *txSeg, uint8_t txSegCnt, uint8_t* rxBuf, uint16_t rxBufLen, uint16_t* actLen, uint32_t flags, uint32_t fwt, SPI* mspiChannel, ST25R3911* mST25, DigitalOut* gpio_cs, InterruptIn* IRQ, DigitalOut* fieldLED_01, DigitalOut* fieldLED_02, DigitalOut* fieldLED_03, DigitalOut* fieldLED_04, DigitalOut* fieldLED_05, DigitalOut* fieldLED_06 )
+{
+    ReturnCode               ret;
+    rfalTransceiveContext    ctx;
+    
+    rfalCreateByteFlagsTxRxContext( ctx, NULL, 0, rxBuf, rxBufLen, actLen, flags, fwt );
+    EXIT_ON_ERR( ret, rfalStartTransceiveSegments( &ctx, txSeg, txSegCnt, mspiChannel, mST25, gpio_cs, IRQ, fieldLED_01, fieldLED_02, fieldLED_03, fieldLED_04, fieldLED_05, fieldLED_06 ) );
+    
+    return rfalTransceiveRunBlockingTx( mspiChannel, mST25, gpio_cs, IRQ, fieldLED_01, fieldLED_02, fieldLED_03, fieldLED_04, fieldLED_05, fieldLED_06 );
+}
+
+
 /*******************************************************************************/
 static ReturnCode rfalTransceiveRunBlockingTx( SPI* mspiChannel, ST25R3911* mST25, DigitalOut* gpio_cs, InterruptIn* IRQ, DigitalOut* fieldLED_01, DigitalOut* fieldLED_02, DigitalOut* fieldLED_03, DigitalOut* fieldLED_04, DigitalOut* fieldLED_05, DigitalOut* fieldLED_06 )
 {
@@ -1576,6 +1655,36 @@ static void rfalPrepareTransceive( SPI* mspiChannel, ST25R3911* mST25, DigitalOu
     rfalFIFOStatusClear();
 }
 
+/*******************************************************************************/
+static void rfalTransceiveWriteFifo( uint16_t offset, uint16_t len, SPI* mspiChannel, ST25R3911* mST25, DigitalOut* gpio_cs, InterruptIn* IRQ, DigitalOut* fieldLED_01, DigitalOut* fieldLED_02, DigitalOut* fieldLED_03, DigitalOut* fieldLED_04, DigitalOut* fieldLED_05, DigitalOut* fieldLED_06 )
+{
+    uint16_t segLen;
+    uint8_t  i;
+    
+    if( gRFAL.TxRx.txSeg == NULL )
+    {
+        mST25 -> writeFifo( gRFAL.TxRx.ctx.txBuf + offset, len, mspiChannel, gpio_cs, IRQ, fieldLED_01, fieldLED_02, fieldLED_03, fieldLED_04, fieldLED_05, fieldLED_06 ) ;
+        return;
+    }
+    
+    /* Stream the part of each segment that falls within [offset, offset+len[ */
+    for( i = 0; ((i < gRFAL.TxRx.txSegCnt) && (len > 0)); i++ )
+    {
+        if( offset >= gRFAL.TxRx.txSeg[i].len )
+        {
+            offset -= gRFAL.TxRx.txSeg[i].len;
+            continue;
+        }
+        
+        segLen = MIN( (gRFAL.TxRx.txSeg[i].len - offset), len );
+        mST25 -> writeFifo( (uint8_t*)&gRFAL.TxRx.txSeg[i].buf[offset], segLen, mspiChannel, gpio_cs, IRQ, fieldLED_01, fieldLED_02, fieldLED_03, fieldLED_04, fieldLED_05, fieldLED_06 ) ;
+        
+        len   -= segLen;
+        offset = 0;
+    }
+}
+
+
 /*******************************************************************************/
 static void rfalTransceiveTx( SPI* mspiChannel, ST25R3911* mST25, DigitalOut* gpio_cs, InterruptIn* IRQ, DigitalOut* fieldLED_01, DigitalOut* fieldLED_02, DigitalOut* fieldLED_03, DigitalOut* fieldLED_04, DigitalOut* fieldLED_05, DigitalOut* fieldLED_06 )
 {
@@ -1683,7 +1792,7 @@ static void rfalTransceiveTx( SPI* mspiChannel, ST25R3911* mST25, DigitalOut* gp
                 
                 /* Load FIFO with total length or FIFO's maximum */
                 gRFAL.fifo.bytesWritten = MIN( gRFAL.fifo.bytesTotal, ST25R3911_FIFO_DEPTH );
-                mST25 -> writeFifo( gRFAL.TxRx.ctx.txBuf, gRFAL.fifo.bytesWritten, mspiChannel, gpio_cs, IRQ, fieldLED_01, fieldLED_02, fieldLED_03, fieldLED_04, fieldLED_05, fieldLED_06 ) ;
+                rfalTransceiveWriteFifo( 0, gRFAL.fifo.bytesWritten, mspiChannel, mST25, gpio_cs, IRQ, fieldLED_01, fieldLED_02, fieldLED_03, fieldLED_04, fieldLED_05, fieldLED_06 );
             }
         
             /*Check if Observation Mode is enabled and set it on ST25R391x */
@@ -1761,7 +1870,7 @@ static void rfalTransceiveTx( SPI* mspiChannel, ST25R3911* mST25, DigitalOut* gp
             {
                 /* Load FIFO with the remaining length or maximum available */
                 tmp = MIN( (gRFAL.fifo.bytesTotal - gRFAL.fifo.bytesWritten), gRFAL.fifo.expWL);       /* tmp holds the number of bytes written on this iteration */
-                mST25 -> writeFifo( gRFAL.TxRx.ctx.txBuf + gRFAL.fifo.bytesWritten, tmp, mspiChannel, gpio_cs, IRQ, fieldLED_01, fieldLED_02, fieldLED_03, fieldLED_04, fieldLED_05, fieldLED_06 ) ;
+                rfalTransceiveWriteFifo( gRFAL.fifo.bytesWritten, tmp, mspiChannel, mST25, gpio_cs, IRQ, fieldLED_01, fieldLED_02, fieldLED_03, fieldLED_04, fieldLED_05, fieldLED_06 );
             }
             
             /* Update total written bytes to FIFO */
@@ -2690,6 +2799,68 @@ ReturnCode rfalISO15693TransceiveEOF( uint8_t *rxBuf, uint8_t rxBufLen, uint16_t
 ReturnCode rfalFeliCaPoll( rfalFeliCaPollSlots slots, uint16_t sysCode, uint8_t reqCode, rfalFeliCaPollRes* pollResList, uint8_t pollResListSize, uint8_t *devicesDetected,
 		uint8_t *collisionsDetected, SPI* mspiChannel, ST25R3911* mST25,
 		DigitalOut* gpio_cs, InterruptIn* IRQ, DigitalOut* fieldLED_01, DigitalOut* fieldLED_02, DigitalOut* fieldLED_03, DigitalOut* fieldLED_04, DigitalOut* fieldLED_05, DigitalOut* fieldLED_06 )
+{
+    ReturnCode        ret;
+    uint8_t           devDetected;
+    uint8_t           colDetected;
+    
+    /* Every slot gets its own container, responses are copied once all slots are done */
+    ret = rfalFeliCaPollRun( slots, sysCode, reqCode, gRFAL.nfcfData.pollResponses, RFAL_FELICA_POLL_MAX_SLOTS, NULL, &devDetected, &colDetected, mspiChannel, mST25, gpio_cs, IRQ, fieldLED_01, fieldLED_02, fieldLED_03, fieldLED_04, fieldLED_05, fieldLED_06 );
+    
+    /*******************************************************************************/
+    /* Assign output parameters if requested                                       */
+    
+    if( (pollResList != NULL) && (pollResListSize > 0) && (devDetected > 0) )
+    {
+        ST_MEMCPY( pollResList, gRFAL.nfcfData.pollResponses, (RFAL_FELICA_POLL_RES_LEN * MIN(pollResListSize, devDetected) ) );
+    }
+    
+    if( devicesDetected != NULL )
+    {
+        *devicesDetected = devDetected;
+    }
+    
+    if( collisionsDetected != NULL )
+    {
+        *collisionsDetected = colDetected;
+    }
+    
+    return ret;
+}
+
+
+/*******************************************************************************/
+ReturnCode rfalFeliCaPollStream( rfalFeliCaPollSlots slots, uint16_t sysCode, uint8_t reqCode, rfalFeliCaPollResCallback resCb,
+		uint8_t *devicesDetected, uint8_t *collisionsDetected, SPI* mspiChannel, ST25R3911* mST25, DigitalOut* gpio_cs, InterruptIn* IRQ, DigitalOut* fieldLED_01, DigitalOut* fieldLED_02, DigitalOut* fieldLED_03, DigitalOut* fieldLED_04, DigitalOut* fieldLED_05, DigitalOut* fieldLED_06 )
+{
+    ReturnCode        ret;
+    uint8_t           devDetected;
+    uint8_t           colDetected;
+    
+    if( resCb == NULL )
+    {
+        return ERR_PARAM;
+    }
+    
+    /* Two containers are enough: one handed to resCb while the next slot is received into the other */
+    ret = rfalFeliCaPollRun( slots, sysCode, reqCode, gRFAL.nfcfData.pollResponses, 2, resCb, &devDetected, &colDetected, mspiChannel, mST25, gpio_cs, IRQ, fieldLED_01, fieldLED_02, fieldLED_03, fieldLED_04, fieldLED_05, fieldLED_06 );
+    
+    if( devicesDetected != NULL )
+    {
+        *devicesDetected = devDetected;
+    }
+    
+    if( collisionsDetected != NULL )
+    {
+        *collisionsDetected = colDetected;
+    }
+    
+    return ret;
+}
+
+
+/*******************************************************************************/
+static ReturnCode rfalFeliCaPollRun( rfalFeliCaPollSlots slots, uint16_t sysCode, uint8_t reqCode, rfalFeliCaPollRes* rxBufs, uint8_t rxBufsCnt, rfalFeliCaPollResCallback resCb, uint8_t *devicesDetected, uint8_t *collisionsDetected, SPI* mspiChannel, ST25R3911* mST25, DigitalOut* gpio_cs, InterruptIn* IRQ, DigitalOut* fieldLED_01, DigitalOut* fieldLED_02, DigitalOut* fieldLED_03, DigitalOut* fieldLED_04, DigitalOut* fieldLED_05, DigitalOut* fieldLED_06 )
 {
     ReturnCode        ret;
     uint8_t           frame[RFAL_FELICA_POLL_REQ_LEN - RFAL_FELICA_LEN_LEN];  /* LEN is added by ST25R3911 automatically */
@@ -2697,9 +2868,13 @@ ReturnCode rfalFeliCaPoll( rfalFeliCaPollSlots slots, uint16_t sysCode, uint8_t
     uint8_t           frameIdx;
     uint8_t           devDetected;
     uint8_t           colDetected;
+    uint8_t*          rxBuf;
     rfalEHandling     curHandling;
     
     int index = (int)slots;
+    
+    *devicesDetected    = 0;
+    *collisionsDetected = 0;
 
     /* Check if RFAL is properly initialized */
     if( (gRFAL.state < RFAL_STATE_MODE_SET) || ( gRFAL.mode != RFAL_MODE_POLL_NFCF ) )
@@ -2732,7 +2907,7 @@ ReturnCode rfalFeliCaPoll( rfalFeliCaPollSlots slots, uint16_t sysCode, uint8_t
      *                       512 PICC process time + (n * 256 Time Slot duration)  */
     ret = rfalTransceiveBlockingTx( frame, 
                                     frameIdx, 
-                                    (uint8_t*)gRFAL.nfcfData.pollResponses, 
+                                    (uint8_t*)rxBufs[0], 
                                     RFAL_FELICA_POLL_RES_LEN, 
                                     &actLen,
                                     (RFAL_TXRX_FLAGS_DEFAULT),
@@ -2761,10 +2936,21 @@ ReturnCode rfalFeliCaPoll( rfalFeliCaPollSlots slots, uint16_t sysCode, uint8_t
                 /* If the reception was OK, new device found */
                 if( ret == ERR_NONE )
                 {
+                   rxBuf = gRFAL.TxRx.ctx.rxBuf;
                    devDetected++;
                    
                    /* Overwrite the Transceive context for the next reception */
-                   gRFAL.TxRx.ctx.rxBuf = (uint8_t*)gRFAL.nfcfData.pollResponses[devDetected];
+                   gRFAL.TxRx.ctx.rxBuf = (uint8_t*)rxBufs[ (devDetected % rxBufsCnt) ];
+                   
+                   /* Hand the response over while the following slot is being received */
+                   if( resCb != NULL )
+                   {
+                       if( !resCb( rxBuf, rfalConvBitsToBytes(actLen), (devDetected - 1) ) )
+                       {
+                           /* Poll cancelled by the caller, the next transceive clears any pending reception */
+                           break;
+                       }
+                   }
                 }
                 /* If the reception was not OK, mark as collision */
                 else
@@ -2791,23 +2977,9 @@ ReturnCode rfalFeliCaPoll( rfalFeliCaPollSlots slots, uint16_t sysCode, uint8_t
     /* Restore NRT to normal mode - back to previous error handling */
     rfalSetErrorHandling( curHandling );
     
-    /*******************************************************************************/
-    /* Assign output parameters if requested                                       */
-    
-    if( (pollResList != NULL) && (pollResListSize > 0) && (devDetected > 0) )
-    {
-        ST_MEMCPY( pollResList, gRFAL.nfcfData.pollResponses, (RFAL_FELICA_POLL_RES_LEN * MIN(pollResListSize, devDetected) ) );
-    }
-    
-    if( devicesDetected != NULL )
-    {
-        *devicesDetected = devDetected;
-    }
+    *devicesDetected    = devDetected;
+    *collisionsDetected = colDetected;
     
-    if( collisionsDetected != NULL )
-    {
-        *collisionsDetected = colDetected;
-    }
     uint16_t ERR_NONEUI = ERR_NONE;
     return (( colDetected || devDetected ) ? ERR_NONEUI : ret);
 }
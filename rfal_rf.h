@@ -404,6 +404,13 @@ typedef struct {
 } rfalTransceiveContext;
 
 
+/*! Struct that holds one segment of a scatter-gather outgoing message                                 */
+typedef struct {
+    const uint8_t*        buf;                /*!< (In)  Location of this segment's data                */
+    uint16_t              len;                /*!< (In)  Length of this segment in bytes                */
+} rfalTransceiveSegment;
+
+
 /*! System callback to indicate an event that requires a system reRun        */
 typedef void (* rfalUpperLayerCallback)(void);
 
@@ -462,6 +469,11 @@ typedef enum
 typedef uint8_t rfalFeliCaPollRes[RFAL_FELICA_POLL_RES_LEN];
 
 
+/*! Callback delivering one FeliCa Poll Response as soon as its slot completes
+ *  pollRes is only valid during the call; return false to stop the Poll      */
+typedef bool (* rfalFeliCaPollResCallback)( const uint8_t *pollRes, uint16_t pollResLen, uint8_t devIdx );
+
+
 /*******************************************************************************/
 
 
@@ -1024,6 +1036,33 @@ ReturnCode rfalFieldOff( SPI* mspiChannel, ST25R3911* mST25, DigitalOut* gpio_cs
 ReturnCode rfalStartTransceive( rfalTransceiveContext *ctx,SPI* mspiChannel, ST25R3911* mST25, DigitalOut* gpio_cs, InterruptIn* IRQ, DigitalOut* fieldLED_01, DigitalOut* fieldLED_02, DigitalOut* fieldLED_03, DigitalOut* fieldLED_04, DigitalOut* fieldLED_05, DigitalOut* fieldLED_06 );
 
 
+/*! 
+ *****************************************************************************
+ * \brief  RFAL Set scatter-gather transceive context
+ *  
+ * Same as rfalStartTransceive() but the outgoing message is given as a list
+ * of segments which are streamed into the FIFO one after the other, 
+ * avoiding the need of a contiguous transmit buffer.
+ * The txBuf and txBufLen of the given context are ignored.
+ * 
+ * The segments list and the data it points to must remain valid until the
+ * Tx has been completed
+ * 
+ * \param[in]  ctx      : the context for the following Transceive
+ * \param[in]  txSeg    : list of segments forming the outgoing message
+ * \param[in]  txSegCnt : number of segments on txSeg
+ * 
+ * \see  rfalStartTransceive
+ *
+ * \return ERR_NONE        : Done with no error
+ * \return ERR_PARAM       : Invalid parameters
+ * \return ERR_NOTSUPP     : Not supported on the current mode (NFC-V)
+ * \return ERR_WRONG_STATE : Not initialized properly 
+ *****************************************************************************
+ */
+ReturnCode rfalStartTransceiveSegments( rfalTransceiveContext *ctx, const rfalTransceiveSegment *txSeg, uint8_t txSegCnt, SPI* mspiChannel, ST25R3911* mST25, DigitalOut* gpio_cs, InterruptIn* IRQ, DigitalOut* fieldLED_01, DigitalOut* fieldLED_02, DigitalOut* fieldLED_03, DigitalOut* fieldLED_04, DigitalOut* fieldLED_05, DigitalOut* fieldLED_06 );
+
+
 /*! 
  *****************************************************************************
  * \brief  Get Transceive State
@@ -1154,6 +1193,38 @@ ReturnCode rfalFeliCaPoll( rfalFeliCaPollSlots slots, uint16_t sysCode, uint8_t
 		uint8_t *collisionsDetected, SPI* mspiChannel, ST25R3911* mST25, DigitalOut* gpio_cs, InterruptIn* IRQ, DigitalOut* fieldLED_01, DigitalOut* fieldLED_02, DigitalOut* fieldLED_03, DigitalOut* fieldLED_04, DigitalOut* fieldLED_05, DigitalOut* fieldLED_06 );
 
 
+/*!
+ *****************************************************************************
+ * \brief FeliCa Poll with per slot delivery
+ * 
+ * Sends a Poll Request and hands every Poll Response over to resCb as soon 
+ * as its slot has been received, instead of only after all slots expired. 
+ * Responses are received directly into an alternating pair of buffers so no 
+ * staging copy is done: the following slot is being received while resCb 
+ * processes the current one.
+ * 
+ * resCb runs in between slots and should return quickly (a slot is ~1.2ms),
+ * typically only recording the NFCID2 or queuing the card for later
+ * Check/Update commands. Returning false cancels the Poll, remaining slots
+ * are not awaited.
+ * 
+ * \param[in]   slots             : number of slots for the Poll Request
+ * \param[in]   sysCode           : system code (SC) for the Poll Request  
+ * \param[in]   reqCode           : request code (RC) for the Poll Request
+ * \param[in]   resCb             : callback called for each Poll Response
+ * \param[out]  devicesDetected   : number of cards found
+ * \param[out]  collisionsDetected: number of collisions detected
+ * 
+ * \return ERR_PARAM if resCb is NULL
+ * \return ERR_WRONG_STATE if RFAL is not in NFC-F poll mode
+ * \return ERR_NONE if there is no error
+ * \return ERR_TIMEOUT if there is no response
+ *****************************************************************************
+ */
+ReturnCode rfalFeliCaPollStream( rfalFeliCaPollSlots slots, uint16_t sysCode, uint8_t reqCode, rfalFeliCaPollResCallback resCb,
+		uint8_t *devicesDetected, uint8_t *collisionsDetected, SPI* mspiChannel, ST25R3911* mST25, DigitalOut* gpio_cs, InterruptIn* IRQ, DigitalOut* fieldLED_01, DigitalOut* fieldLED_02, DigitalOut* fieldLED_03, DigitalOut* fieldLED_04, DigitalOut* fieldLED_05, DigitalOut* fieldLED_06 );
+
+
 /*****************************************************************************
  *  ISO15693                                                                 *  
  *****************************************************************************/
@@ -1217,7 +1288,7 @@ ReturnCode rfalISO15693TransceiveAnticollisionEOF( uint8_t *rxBuf, uint8_t rxBuf
  * \return  ERR_IO          : Internal error
  *****************************************************************************
  */
-ReturnCode rfalISO15693TransceiveEOF( uint8_t *rxBuf, uint8_t rxBufLen, uint16_t *actLen, SPI* mspiChannel, ST25R3911* mST25, DigitalOut* gpio_cs, InterruptIn* IRQ  );
+ReturnCode rfalISO15693TransceiveEOF( uint8_t *rxBuf, uint8_t rxBufLen, uint16_t *actLen, SPI* mspiChannel, ST25R3911* mST25, DigitalOut* gpio_cs, InterruptIn* IRQ, DigitalOut* fieldLED_01, DigitalOut* fieldLED_02, DigitalOut* fieldLED_03, DigitalOut* fieldLED_04, DigitalOut* fieldLED_05, DigitalOut* fieldLED_06 );
 
 
 /*!
@@ -1245,6 +1316,29 @@ ReturnCode rfalISO15693TransceiveEOF( uint8_t *rxBuf, uint8_t rxBufLen, uint16_t
  */
 ReturnCode rfalTransceiveBlockingTx( uint8_t* txBuf, uint16_t txBufLen, uint8_t* rxBuf, uint16_t rxBufLen, uint16_t* actLen, uint32_t flags, uint32_t fwt, SPI* mspiChannel, ST25R3911* mST25, DigitalOut* gpio_cs, InterruptIn* IRQ, DigitalOut* fieldLED_01, DigitalOut* fieldLED_02, DigitalOut* fieldLED_03, DigitalOut* fieldLED_04, DigitalOut* fieldLED_05, DigitalOut* fieldLED_06 );
 
+/*!
+ *****************************************************************************
+ * \brief Transceive Blocking Tx from segments
+ *
+ * Same as rfalTransceiveBlockingTx() but the outgoing message is given as
+ * a list of segments, see rfalStartTransceiveSegments()
+ * 
+ * \param[in]  txSeg    : list of segments forming the outgoing message
+ * \param[in]  txSegCnt : number of segments on txSeg
+ * \param[out] rxBuf    : Buffer where incoming message will be placed
+ * \param[in]  rxBufLen : Maximum length of the incoming message in bytes
+ * \param[out] actLen   : Actual received length in bits
+ * \param[in]  flags    : TransceiveFlags indication special handling
+ * \param[in]  fwt      : Frame Waiting Time in 1/fc
+ * 
+ * \return  ERR_NONE         : Transceive done with no error
+ * \return  ERR_PARAM        : Invalid parameters
+ * \return  ERR_NOTSUPP      : Not supported on the current mode (NFC-V)
+ * \return  ERR_XXXX         : Error occurred
+ *****************************************************************************
+ */
+ReturnCode rfalTransceiveBlockingTxSegments( const rfalTransceiveSegment *txSeg, uint8_t txSegCnt, uint8_t* rxBuf, uint16_t rxBufLen, uint16_t* actLen, uint32_t flags, uint32_t fwt, SPI* mspiChannel, ST25R3911* mST25, DigitalOut* gpio_cs, InterruptIn* IRQ, DigitalOut* fieldLED_01, DigitalOut* fieldLED_02, DigitalOut* fieldLED_03, DigitalOut* fieldLED_04, DigitalOut* fieldLED_05, DigitalOut* fieldLED_06 );
+
 /*!
  *****************************************************************************
  * \brief Transceive Blocking Rx 
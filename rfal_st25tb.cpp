@@ -79,6 +79,7 @@
 
 #define RFAL_ST25TB_T0               2157                              /*!< ST25TB t0  159 us   ST25TB RF characteristics    */
 #define RFAL_ST25TB_T1               2048                              /*!< ST25TB t1  151 us   ST25TB RF characteristics    */
+#define RFAL_ST25TB_T2               1356                              /*!< ST25TB t2  100 us   Answer to new request delay, with margin */
 
 #define RFAL_ST25TB_FWT             (RFAL_ST25TB_T0 + RFAL_ST25TB_T1)  /*!< ST25TB FWT  = T0 + T1                            */
 #define RFAL_ST25TB_TW              rfalConvMsTo1fc(7)                 /*!< ST25TB TW : Programming time for write max 7ms   */
@@ -90,6 +91,10 @@
  ******************************************************************************
  */
 
+#define rfalSt25tbImageIsValid( img, b )   (((b) < RFAL_ST25TB_IMAGE_BLOCKS) && (((img)->valid[(b) / 8] & (1 << ((b) % 8))) != 0))  /*!< Checks if the block is known on the image */
+#define rfalSt25tbImageSetValid( img, b )  ((img)->valid[(b) / 8] |= (1 << ((b) % 8)))                                                  /*!< Marks the block as known on the image     */
+#define rfalSt25tbImageClrValid( img, b )  ((img)->valid[(b) / 8] &= ~(1 << ((b) % 8)))                                                 /*!< Marks the block as unknown on the image   */
+
 /*
 ******************************************************************************
 * GLOBAL TYPES
@@ -139,6 +144,9 @@ typedef struct
 * LOCAL FUNCTION PROTOTYPES
 ******************************************************************************
 */
+static ReturnCode rfalSt25tbPollerAddDevice( uint8_t chipId, rfalSt25tbListenDevice *st25tbDevList, uint8_t *devCnt, SPI* mspiChannel, ST25R3911* mST25, DigitalOut* gpio_cs, InterruptIn* IRQ, DigitalOut* fieldLED_01, DigitalOut* fieldLED_02, DigitalOut* fieldLED_03, DigitalOut* fieldLED_04, DigitalOut* fieldLED_05, DigitalOut* fieldLED_06 );
+static ReturnCode rfalSt25tbPollerSlot( uint8_t slotNum, uint8_t devLimit, rfalSt25tbListenDevice *st25tbDevList, uint8_t *devCnt, SPI* mspiChannel, ST25R3911* mST25, DigitalOut* gpio_cs, InterruptIn* IRQ, DigitalOut* fieldLED_01, DigitalOut* fieldLED_02, DigitalOut* fieldLED_03, DigitalOut* fieldLED_04, DigitalOut* fieldLED_05, DigitalOut* fieldLED_06 );
+static ReturnCode rfalSt25tbPollerWriteBlockNoVerify( uint8_t blockAddress, const rfalSt25tbBlock *blockData, SPI* mspiChannel, ST25R3911* mST25, DigitalOut* gpio_cs, InterruptIn* IRQ, DigitalOut* fieldLED_01, DigitalOut* fieldLED_02, DigitalOut* fieldLED_03, DigitalOut* fieldLED_04, DigitalOut* fieldLED_05, DigitalOut* fieldLED_06 );
 
 
 /*
@@ -147,6 +155,96 @@ typedef struct
 ******************************************************************************
 */
 
+/*
+******************************************************************************
+* LOCAL FUNCTIONS
+******************************************************************************
+*/
+
+static ReturnCode rfalSt25tbPollerAddDevice( uint8_t chipId, rfalSt25tbListenDevice *st25tbDevList, uint8_t *devCnt, SPI* mspiChannel, ST25R3911* mST25, DigitalOut* gpio_cs, InterruptIn* IRQ, DigitalOut* fieldLED_01, DigitalOut* fieldLED_02, DigitalOut* fieldLED_03, DigitalOut* fieldLED_04, DigitalOut* fieldLED_05, DigitalOut* fieldLED_06 )
+{
+    ReturnCode ret;
+    
+    st25tbDevList[*devCnt].chipID       = chipId;
+    st25tbDevList[*devCnt].isDeselected = false;
+    
+    /* Select Device, retrieve its UID  */
+    ret = rfalSt25tbPollerSelect( chipId, mspiChannel, mST25, gpio_cs, IRQ, fieldLED_01, fieldLED_02, fieldLED_03, fieldLED_04, fieldLED_05, fieldLED_06 );
+    
+    /* By Selecting this device, the previous gets Deselected */
+    if( (*devCnt) > 0 )
+    {
+        st25tbDevList[(*devCnt)-1].isDeselected = true;
+    }
+    
+    if( ERR_NONE == ret )
+    {
+        ret = rfalSt25tbPollerGetUID( &st25tbDevList[*devCnt].UID, mspiChannel, mST25, gpio_cs, IRQ, fieldLED_01, fieldLED_02, fieldLED_03, fieldLED_04, fieldLED_05, fieldLED_06 );
+    }
+    
+    if( ERR_NONE == ret )
+    {
+        (*devCnt)++;
+    }
+    
+    return ret;
+}
+
+
+/*******************************************************************************/
+static ReturnCode rfalSt25tbPollerSlot( uint8_t slotNum, uint8_t devLimit, rfalSt25tbListenDevice *st25tbDevList, uint8_t *devCnt, SPI* mspiChannel, ST25R3911* mST25, DigitalOut* gpio_cs, InterruptIn* IRQ, DigitalOut* fieldLED_01, DigitalOut* fieldLED_02, DigitalOut* fieldLED_03, DigitalOut* fieldLED_04, DigitalOut* fieldLED_05, DigitalOut* fieldLED_06 )
+{
+    ReturnCode ret;
+    uint8_t    chipId;
+    
+    if( slotNum == 0 )
+    {
+        /* Step 2: Send Pcall16 */
+        ret = rfalSt25tbPollerPcall( &chipId, mspiChannel, mST25, gpio_cs, IRQ, fieldLED_01, fieldLED_02, fieldLED_03, fieldLED_04, fieldLED_05, fieldLED_06 );
+    }
+    else
+    {
+        /* Step 3-17: Send SlotMarker */
+        ret = rfalSt25tbPollerSlotMarker( slotNum, &chipId, mspiChannel, mST25, gpio_cs, IRQ, fieldLED_01, fieldLED_02, fieldLED_03, fieldLED_04, fieldLED_05, fieldLED_06 );
+    }
+    
+    if( (ret == ERR_NONE) && (*devCnt < devLimit) )
+    {
+        /* Found another device */
+        rfalSt25tbPollerAddDevice( chipId, st25tbDevList, devCnt, mspiChannel, mST25, gpio_cs, IRQ, fieldLED_01, fieldLED_02, fieldLED_03, fieldLED_04, fieldLED_05, fieldLED_06 );
+    }
+    
+    return ret;
+}
+
+
+/*******************************************************************************/
+static ReturnCode rfalSt25tbPollerWriteBlockNoVerify( uint8_t blockAddress, const rfalSt25tbBlock *blockData, SPI* mspiChannel, ST25R3911* mST25, DigitalOut* gpio_cs, InterruptIn* IRQ, DigitalOut* fieldLED_01, DigitalOut* fieldLED_02, DigitalOut* fieldLED_03, DigitalOut* fieldLED_04, DigitalOut* fieldLED_05, DigitalOut* fieldLED_06 )
+{
+    ReturnCode              ret;
+    uint16_t                rxLen;
+    rfalSt25tbWriteBlockReq writeBlockReq;
+    rfalSt25tbBlock         tmpBlockData; 
+    
+    /* Compute Write Block Request */
+    writeBlockReq.cmd     = RFAL_ST25TB_WRITE_BLOCK_CMD;
+    writeBlockReq.address = blockAddress;
+    ST_MEMCPY( writeBlockReq.data, blockData, RFAL_ST25TB_BLOCK_LEN );
+    
+    /* Send Write Block Request, no answer is sent: the timeout covers the programming time */
+    ret = rfalTransceiveBlockingTxRx( (uint8_t*)&writeBlockReq, sizeof(rfalSt25tbWriteBlockReq), tmpBlockData, RFAL_ST25TB_BLOCK_LEN, &rxLen, RFAL_TXRX_FLAGS_DEFAULT, (RFAL_ST25TB_FWT + RFAL_ST25TB_TW), mspiChannel, mST25, gpio_cs, IRQ, fieldLED_01, fieldLED_02, fieldLED_03, fieldLED_04, fieldLED_05, fieldLED_06 );
+    
+    /* Check if an unexpected answer was received */
+    if( ret == ERR_NONE )
+    {
+        return ERR_PROTO; 
+    }
+    
+    /* Check there was any error besides Timeout*/
+    return ((ret == ERR_TIMEOUT) ? ERR_NONE : ret);
+}
+
+
 /*
 ******************************************************************************
 * GLOBAL FUNCTIONS
@@ -325,8 +423,9 @@ ReturnCode rfalSt25tbPollerCollisionResolution( uint8_t devLimit, rfalSt25tbList
 {
     uint8_t    i;
     uint8_t    chipId;
+    uint32_t   fdtPoll;
     ReturnCode ret;
-    bool       detected;  /* collision or device was detected */
+    bool       detected;  /* collision was detected on the current round */
     
     if( (st25tbDevList == NULL) || (devCnt == NULL) || (devLimit == 0) )
     {
@@ -336,88 +435,37 @@ ReturnCode rfalSt25tbPollerCollisionResolution( uint8_t devLimit, rfalSt25tbList
     *devCnt = 0;
     
     /* Step 1: Send Initiate */
-    ret = rfalSt25tbPollerInitiate( &chipId, mspiChannel, mST25, gpio_cs, IRQ, fieldLED_01, fieldLED_02, fieldLED_03, fieldLED_04, fieldLED_05, fieldLED_06 ) ;
+    ret = rfalSt25tbPollerInitiate( &chipId, mspiChannel, mST25, gpio_cs, IRQ, fieldLED_01, fieldLED_02, fieldLED_03, fieldLED_04, fieldLED_05, fieldLED_06 );
     if( ret == ERR_NONE )
     {
-        /* If only 1 answer is detected */
-        st25tbDevList[*devCnt].chipID       = chipId;
-        st25tbDevList[*devCnt].isDeselected = false;
-        
-        /* Retrieve its UID and keep it Selected*/
-        ret = rfalSt25tbPollerSelect( chipId, mspiChannel, mST25, gpio_cs, IRQ, fieldLED_01, fieldLED_02, fieldLED_03, fieldLED_04, fieldLED_05, fieldLED_06 ) ;
-        
-        if( ERR_NONE == ret )
-        {
-            ret = rfalSt25tbPollerGetUID( &st25tbDevList[*devCnt].UID, mspiChannel, mST25, gpio_cs, IRQ, fieldLED_01, fieldLED_02, fieldLED_03, fieldLED_04, fieldLED_05, fieldLED_06 ) ;
-        }
-        
-        if( ERR_NONE == ret )
-        {
-            (*devCnt)++;
-        }
+        /* If only 1 answer is detected retrieve its UID and keep it Selected */
+        rfalSt25tbPollerAddDevice( chipId, st25tbDevList, devCnt, mspiChannel, mST25, gpio_cs, IRQ, fieldLED_01, fieldLED_02, fieldLED_03, fieldLED_04, fieldLED_05, fieldLED_06 );
     }
+    
+    /* Wait t2 (Answer to new request delay) before each request through the FDT Poll timer,  *
+     * started by the chip at the end of each reception instead of a ms delay for every slot  */
+    fdtPoll = rfalGetFDTPoll();
+    rfalSetFDTPoll( RFAL_ST25TB_T2 );
+    
     /* Always proceed to Pcall16 anticollision as phase differences of tags can lead to no tag recognized, even if there is one */
-    if( *devCnt < devLimit )
+    /* Devices keep their slot until the next Pcall16, a collided slot can only be resolved by a new round */
+    do
     {
-        /* Multiple device responses */
-        do
+        detected = false;
+        
+        for( i = 0; (i < RFAL_ST25TB_SLOTS) && (*devCnt < devLimit); i++ )
         {
-            detected = false;
+            ret = rfalSt25tbPollerSlot( i, devLimit, st25tbDevList, devCnt, mspiChannel, mST25, gpio_cs, IRQ, fieldLED_01, fieldLED_02, fieldLED_03, fieldLED_04, fieldLED_05, fieldLED_06 );
             
-            for(i = 0; i < RFAL_ST25TB_SLOTS; i++)
+            if( (ret == ERR_CRC) || (ret == ERR_FRAMING) )
             {
-                platformDelay(1);  /* Wait t2: Answer to new request delay  */
-                
-                if( i==0 )
-                {
-                    /* Step 2: Send Pcall16 */
-                    ret = rfalSt25tbPollerPcall( &chipId, mspiChannel, mST25, gpio_cs, IRQ, fieldLED_01, fieldLED_02, fieldLED_03, fieldLED_04, fieldLED_05, fieldLED_06 ) ;
-                }
-                else
-                {
-                    /* Step 3-17: Send Pcall16 */
-                    ret = rfalSt25tbPollerSlotMarker( i, &chipId, mspiChannel, mST25, gpio_cs, IRQ, fieldLED_01, fieldLED_02, fieldLED_03, fieldLED_04, fieldLED_05, fieldLED_06 ) ;
-                }
-                
-                if( ret == ERR_NONE )
-                {
-                    /* Found another device */
-                    st25tbDevList[*devCnt].chipID       = chipId;
-                    st25tbDevList[*devCnt].isDeselected = false;
-                    
-                    /* Select Device, retrieve its UID  */
-                    ret = rfalSt25tbPollerSelect( chipId, mspiChannel, mST25, gpio_cs, IRQ, fieldLED_01, fieldLED_02, fieldLED_03, fieldLED_04, fieldLED_05, fieldLED_06 ) ;
-
-                    /* By Selecting this device, the previous gets Deselected */
-                    if( (*devCnt) > 0 )
-                    {
-                        st25tbDevList[(*devCnt)-1].isDeselected = true;
-                    }
-
-                    if( ERR_NONE == ret )
-                    {
-                        rfalSt25tbPollerGetUID( &st25tbDevList[*devCnt].UID, mspiChannel, mST25, gpio_cs, IRQ, fieldLED_01, fieldLED_02, fieldLED_03, fieldLED_04, fieldLED_05, fieldLED_06 ) ;
-                    }
-
-                    if( ERR_NONE == ret )
-                    {
-                        (*devCnt)++;
-                    }
-                }
-                else if( (ret == ERR_CRC) || (ret == ERR_FRAMING) )
-                {
-                    detected = true;
-                }
-                
-                if( *devCnt >= devLimit )
-                {
-                    break;
-                }
+                detected = true;
             }
         }
-        while( (detected == true) && (*devCnt < devLimit) );
     }
-
+    while( detected && (*devCnt < devLimit) );
+    
+    rfalSetFDTPoll( fdtPoll );
     return ERR_NONE;
 }
 
@@ -451,43 +499,177 @@ ReturnCode rfalSt25tbPollerReadBlock( uint8_t blockAddress, rfalSt25tbBlock *blo
 ReturnCode rfalSt25tbPollerWriteBlock( uint8_t blockAddress, rfalSt25tbBlock *blockData,SPI* mspiChannel, ST25R3911* mST25, DigitalOut* gpio_cs, InterruptIn* IRQ, DigitalOut* fieldLED_01, DigitalOut* fieldLED_02, DigitalOut* fieldLED_03, DigitalOut* fieldLED_04, DigitalOut* fieldLED_05, DigitalOut* fieldLED_06 )
 {
     ReturnCode              ret;
-    uint16_t                rxLen;
-    rfalSt25tbWriteBlockReq writeBlockReq;
     rfalSt25tbBlock         tmpBlockData; 
     
+    EXIT_ON_ERR( ret, rfalSt25tbPollerWriteBlockNoVerify( blockAddress, (const rfalSt25tbBlock*)blockData, mspiChannel, mST25, gpio_cs, IRQ, fieldLED_01, fieldLED_02, fieldLED_03, fieldLED_04, fieldLED_05, fieldLED_06 ) );
+    
+    ret = rfalSt25tbPollerReadBlock(blockAddress, &tmpBlockData, mspiChannel, mST25, gpio_cs, IRQ, fieldLED_01, fieldLED_02, fieldLED_03, fieldLED_04, fieldLED_05, fieldLED_06 ) ;
+    if( ret == ERR_NONE )
+    {
+        if( !ST_BYTECMP( tmpBlockData, blockData, RFAL_ST25TB_BLOCK_LEN ) )
+        {
+            return ERR_NONE;
+        }
+        return ERR_PROTO;
+    }
+    return ret;
+}
 
-    /* Compute Write Block Request */
-    writeBlockReq.cmd     = RFAL_ST25TB_WRITE_BLOCK_CMD;
-    writeBlockReq.address = blockAddress;
-    ST_MEMCPY( writeBlockReq.data, blockData, RFAL_ST25TB_BLOCK_LEN );
+
+/*******************************************************************************/
+ReturnCode rfalSt25tbPollerReadBlocks( uint8_t firstBlock, uint16_t blockCnt, rfalSt25tbBlock *blockData, rfalSt25tbImage *image, SPI* mspiChannel, ST25R3911* mST25, DigitalOut* gpio_cs, InterruptIn* IRQ, DigitalOut* fieldLED_01, DigitalOut* fieldLED_02, DigitalOut* fieldLED_03, DigitalOut* fieldLED_04, DigitalOut* fieldLED_05, DigitalOut* fieldLED_06 )
+{
+    uint16_t   i;
+    uint8_t    blk;
+    uint32_t   fdtPoll;
+    ReturnCode ret;
+    
+    if( (blockData == NULL) || (blockCnt == 0) || ((firstBlock + blockCnt) > (UINT8_MAX + 1)) )
+    {
+        return ERR_PARAM;
+    }
     
-    /* Send Write Block Request */
-    ret = rfalTransceiveBlockingTxRx( (uint8_t*)&writeBlockReq, sizeof(rfalSt25tbWriteBlockReq), tmpBlockData, RFAL_ST25TB_BLOCK_LEN, &rxLen, RFAL_TXRX_FLAGS_DEFAULT, (RFAL_ST25TB_FWT + RFAL_ST25TB_TW), mspiChannel, mST25, gpio_cs, IRQ, fieldLED_01, fieldLED_02, fieldLED_03, fieldLED_04, fieldLED_05, fieldLED_06 ) ;
+    /* Send the next request t2 after each response instead of the NFC-B FDT Poll */
+    fdtPoll = rfalGetFDTPoll();
+    rfalSetFDTPoll( RFAL_ST25TB_T2 );
     
-    /* Check if an unexpected answer was received */
-    if( ret == ERR_NONE )
+    ret = ERR_NONE;
+    for( i = 0; i < blockCnt; i++ )
     {
-        return ERR_PROTO; 
+        blk = (uint8_t)(firstBlock + i);
+        
+        ret = rfalSt25tbPollerReadBlock( blk, &blockData[i], mspiChannel, mST25, gpio_cs, IRQ, fieldLED_01, fieldLED_02, fieldLED_03, fieldLED_04, fieldLED_05, fieldLED_06 );
+        if( ret != ERR_NONE )
+        {
+            break;
+        }
+        
+        if( (image != NULL) && (blk < RFAL_ST25TB_IMAGE_BLOCKS) )
+        {
+            ST_MEMCPY( image->block[blk], blockData[i], RFAL_ST25TB_BLOCK_LEN );
+            rfalSt25tbImageSetValid( image, blk );
+        }
     }
-    /* Check there was any error besides Timeout*/
-    else if( ret != ERR_TIMEOUT )
+    
+    rfalSetFDTPoll( fdtPoll );
+    return ret;
+}
+
+
+/*******************************************************************************/
+ReturnCode rfalSt25tbPollerWriteBlocks( uint8_t firstBlock, uint16_t blockCnt, const rfalSt25tbBlock *blockData, rfalSt25tbImage *image, uint16_t *blocksWritten, SPI* mspiChannel, ST25R3911* mST25, DigitalOut* gpio_cs, InterruptIn* IRQ, DigitalOut* fieldLED_01, DigitalOut* fieldLED_02, DigitalOut* fieldLED_03, DigitalOut* fieldLED_04, DigitalOut* fieldLED_05, DigitalOut* fieldLED_06 )
+{
+    uint16_t        i;
+    uint8_t         blk;
+    uint8_t         written[(UINT8_MAX + 1) / 8];
+    uint16_t        writtenCnt;
+    uint32_t        fdtPoll;
+    rfalSt25tbBlock readBack;
+    ReturnCode      ret;
+    
+    if( (blockData == NULL) || (image == NULL) || (blockCnt == 0) || ((firstBlock + blockCnt) > (UINT8_MAX + 1)) )
     {
-        return ret;
+        return ERR_PARAM;
     }
     
-    ret = rfalSt25tbPollerReadBlock(blockAddress, &tmpBlockData, mspiChannel, mST25, gpio_cs, IRQ, fieldLED_01, fieldLED_02, fieldLED_03, fieldLED_04, fieldLED_05, fieldLED_06 ) ;
-    if( ret == ERR_NONE )
+    ST_MEMSET( written, 0x00, sizeof(written) );
+    writtenCnt = 0;
+    
+    if( blocksWritten != NULL )
     {
-        if( !ST_BYTECMP( tmpBlockData, blockData, RFAL_ST25TB_BLOCK_LEN ) )
+        *blocksWritten = 0;
+    }
+    
+    fdtPoll = rfalGetFDTPoll();
+    rfalSetFDTPoll( RFAL_ST25TB_T2 );
+    
+    /*******************************************************************************/
+    /* Write all the changed blocks, skipping the ones the image knows to be equal  */
+    ret = ERR_NONE;
+    for( i = 0; i < blockCnt; i++ )
+    {
+        blk = (uint8_t)(firstBlock + i);
+        
+        if( rfalSt25tbImageIsValid( image, blk ) && (ST_BYTECMP( image->block[blk], blockData[i], RFAL_ST25TB_BLOCK_LEN ) == 0) )
         {
-            return ERR_NONE;
+            continue;
+        }
+        
+        /* Until verified the block content is unknown */
+        if( blk < RFAL_ST25TB_IMAGE_BLOCKS )
+        {
+            rfalSt25tbImageClrValid( image, blk );
+        }
+        
+        ret = rfalSt25tbPollerWriteBlockNoVerify( blk, &blockData[i], mspiChannel, mST25, gpio_cs, IRQ, fieldLED_01, fieldLED_02, fieldLED_03, fieldLED_04, fieldLED_05, fieldLED_06 );
+        if( ret != ERR_NONE )
+        {
+            break;
+        }
+        
+        written[blk / 8] |= (1 << (blk % 8));
+        writtenCnt++;
+    }
+    
+    /*******************************************************************************/
+    /* Verify all the written blocks at once, reading them back to back             */
+    for( i = 0; (ret == ERR_NONE) && (i < blockCnt); i++ )
+    {
+        blk = (uint8_t)(firstBlock + i);
+        
+        if( (written[blk / 8] & (1 << (blk % 8))) == 0 )
+        {
+            continue;
+        }
+        
+        ret = rfalSt25tbPollerReadBlock( blk, &readBack, mspiChannel, mST25, gpio_cs, IRQ, fieldLED_01, fieldLED_02, fieldLED_03, fieldLED_04, fieldLED_05, fieldLED_06 );
+        if( ret != ERR_NONE )
+        {
+            break;
+        }
+        
+        if( blk < RFAL_ST25TB_IMAGE_BLOCKS )
+        {
+            ST_MEMCPY( image->block[blk], readBack, RFAL_ST25TB_BLOCK_LEN );
+            rfalSt25tbImageSetValid( image, blk );
+        }
+        
+        if( ST_BYTECMP( readBack, blockData[i], RFAL_ST25TB_BLOCK_LEN ) != 0 )
+        {
+            ret = ERR_PROTO;
         }
-        return ERR_PROTO;
     }
+    
+    rfalSetFDTPoll( fdtPoll );
+    
+    if( blocksWritten != NULL )
+    {
+        *blocksWritten = writtenCnt;
+    }
+    
     return ret;
 }
 
 
+/*******************************************************************************/
+void rfalSt25tbImageBind( rfalSt25tbImage *image, const rfalSt25tbUID UID )
+{
+    if( (image == NULL) || (UID == NULL) )
+    {
+        return;
+    }
+    
+    /* Same device: keep the known blocks */
+    if( ST_BYTECMP( image->UID, UID, RFAL_ST25TB_UID_LEN ) == 0 )
+    {
+        return;
+    }
+    
+    ST_MEMSET( (uint8_t*)image, 0x00, sizeof(rfalSt25tbImage) );
+    ST_MEMCPY( image->UID, UID, RFAL_ST25TB_UID_LEN );
+}
+
+
 /*******************************************************************************/
 ReturnCode rfalSt25tbPollerCompletion( SPI*  mspiChannel, ST25R3911* mST25, DigitalOut* gpio_cs, InterruptIn* IRQ, DigitalOut* fieldLED_01, DigitalOut* fieldLED_02, DigitalOut* fieldLED_03, DigitalOut* fieldLED_04, DigitalOut* fieldLED_05, DigitalOut* fieldLED_06 )
 {
@@ -70,6 +70,7 @@
 #define RFAL_ST25TB_CRC_LEN          2       /*!< ST25TB CRC length           */
 #define RFAL_ST25TB_UID_LEN          8       /*!< ST25TB Unique ID length     */
 #define RFAL_ST25TB_BLOCK_LEN        4       /*!< ST25TB Data Block length    */
+#define RFAL_ST25TB_IMAGE_BLOCKS     128     /*!< ST25TB blocks kept on a block image, whole SRIX4K user area */
 
 /*
 ******************************************************************************
@@ -97,6 +98,15 @@ typedef struct
 }rfalSt25tbListenDevice;
 
 
+/*! ST25TB block image: last known content of blocks 0 to RFAL_ST25TB_IMAGE_BLOCKS-1 of a device */
+typedef struct
+{
+    rfalSt25tbUID     UID;                                          /*!< UID of the device the image belongs to */
+    uint8_t           valid[RFAL_ST25TB_IMAGE_BLOCKS / 8];          /*!< Known blocks bitmap                    */
+    rfalSt25tbBlock   block[RFAL_ST25TB_IMAGE_BLOCKS];              /*!< Blocks content                         */
+}rfalSt25tbImage;
+
+
 /*
 ******************************************************************************
 * GLOBAL FUNCTION PROTOTYPES
@@ -147,6 +157,10 @@ ReturnCode rfalSt25tbPollerCheckPresence( uint8_t *chipId, SPI* mspiChannel, ST2
  * In case only one device is identified the ST25TB device is left in select
  * state.
  *
+ * Devices keep their slot until the next Pcall16 and the protocol has no 
+ * way to repoll a single slot: a collided SlotMarker slot answers the same 
+ * way again, so Pcall16 rounds are repeated while collisions are detected.
+ *
  * \param[in]  devLimit      : device limit value, and size st25tbDevList
  * \param[out] st25tbDevList : ST35TB listener device info
  * \param[out] devCnt        : Devices found counter
@@ -308,6 +322,70 @@ ReturnCode rfalSt25tbPollerReadBlock( uint8_t blockAddress, rfalSt25tbBlock *blo
 ReturnCode rfalSt25tbPollerWriteBlock( uint8_t blockAddress, rfalSt25tbBlock *blockData,SPI* mspiChannel, ST25R3911* mST25, DigitalOut* gpio_cs, InterruptIn* IRQ, DigitalOut* fieldLED_01, DigitalOut* fieldLED_02, DigitalOut* fieldLED_03, DigitalOut* fieldLED_04, DigitalOut* fieldLED_05, DigitalOut* fieldLED_06 );
 
 
+/*!
+ *****************************************************************************
+ * \brief  ST25TB Poller Read Blocks
+ *
+ * This method reads a range of consecutive blocks of the ST25TB, the Read
+ * Block requests are sent back to back only waiting t2 after each response.
+ * If an image is given the blocks read are stored on it
+ *
+ * \param[in]   firstBlock   : address of the first block to be read
+ * \param[in]   blockCnt     : number of blocks to be read
+ * \param[out]  blockData    : location to place the blockCnt blocks read
+ * \param[out]  image        : block image to be updated, may be NULL
+ *
+ * \return ERR_WRONG_STATE  : RFAL not initialized or incorrect mode
+ * \return ERR_PARAM        : Invalid parameters
+ * \return ERR_TIMEOUT      : Timeout error, no listener device detected
+ * \return ERR_PROTO        : Protocol error detected
+ * \return ERR_NONE         : No error
+ *****************************************************************************
+ */
+ReturnCode rfalSt25tbPollerReadBlocks( uint8_t firstBlock, uint16_t blockCnt, rfalSt25tbBlock *blockData, rfalSt25tbImage *image, SPI* mspiChannel, ST25R3911* mST25, DigitalOut* gpio_cs, InterruptIn* IRQ, DigitalOut* fieldLED_01, DigitalOut* fieldLED_02, DigitalOut* fieldLED_03, DigitalOut* fieldLED_04, DigitalOut* fieldLED_05, DigitalOut* fieldLED_06 );
+
+
+/*!
+ *****************************************************************************
+ * \brief  ST25TB Poller Write Blocks
+ *
+ * This method writes a range of consecutive blocks of the ST25TB. Blocks 
+ * whose content on the image already matches are skipped. The remaining
+ * ones are written one after the other, each one waiting only the block 
+ * programming time, and are then all read back at once for verification.
+ * The image is updated with the read back content
+ *
+ * \param[in]     firstBlock    : address of the first block to be written
+ * \param[in]     blockCnt      : number of blocks to be written
+ * \param[in]     blockData     : the blockCnt blocks to be written
+ * \param[in,out] image         : block image of the device
+ * \param[out]    blocksWritten : number of blocks actually written, may be NULL
+ *
+ * \return ERR_WRONG_STATE  : RFAL not initialized or incorrect mode
+ * \return ERR_PARAM        : Invalid parameters
+ * \return ERR_TIMEOUT      : Timeout error, no listener device detected
+ * \return ERR_PROTO        : Protocol error detected, or a block read back 
+ *                            doesn't match the data written
+ * \return ERR_NONE         : No error
+ *****************************************************************************
+ */
+ReturnCode rfalSt25tbPollerWriteBlocks( uint8_t firstBlock, uint16_t blockCnt, const rfalSt25tbBlock *blockData, rfalSt25tbImage *image, uint16_t *blocksWritten, SPI* mspiChannel, ST25R3911* mST25, DigitalOut* gpio_cs, InterruptIn* IRQ, DigitalOut* fieldLED_01, DigitalOut* fieldLED_02, DigitalOut* fieldLED_03, DigitalOut* fieldLED_04, DigitalOut* fieldLED_05, DigitalOut* fieldLED_06 );
+
+
+/*!
+ *****************************************************************************
+ * \brief  ST25TB Image Bind
+ *
+ * Binds the image to the device with the given UID. The known blocks are 
+ * kept if the UID is the one already bound, dropped otherwise
+ *
+ * \param[in,out] image : block image
+ * \param[in]     UID   : UID of the device
+ *****************************************************************************
+ */
+void rfalSt25tbImageBind( rfalSt25tbImage *image, const rfalSt25tbUID UID );
+
+
 /*!
  *****************************************************************************
  * \brief  ST25TB Poller Completion
@@ -71,6 +71,8 @@
 #define RFAL_T1T_RID_RES_HR0_VAL    0x10    /*!< HR0 indicating NDEF support  Digital 2.0 (Candidate) 11.6.2.1        */
 #define RFAL_T1T_RID_RES_HR0_MASK   0xF0    /*!< HR0 most significant nibble mask                                     */
 
+#define RFAL_T1T_ADDS_SHIFT         4       /*!< Segment number position on ADDS                   T1T 1.2  5.7.1     */
+
 /*
 ******************************************************************************
 * GLOBAL TYPES
@@ -114,11 +116,70 @@ typedef struct
     uint8_t data;                                            /*!< DAT                       */
 } rfalT1TWriteRes;
 
+
+/*! NFC-A T1T (Topaz) RSEG_REQ, READ8_REQ, WRITE-E8_REQ and WRITE-NE8_REQ   T1T 1.2  Table 4 */
+typedef struct
+{
+    uint8_t cmd;                                             /*!< T1T cmd                   */
+    uint8_t add;                                             /*!< ADDS / ADD8               */
+    uint8_t data[RFAL_T1T_BLOCK_LEN];                        /*!< DATA8: 0x00 on reads      */
+    uint8_t uid[RFAL_T1T_UID_LEN];                           /*!< UID                       */
+} rfalT1TBlockReq;
+
+
+/*! NFC-A T1T (Topaz) READ8_RES, WRITE-E8_RES and WRITE-NE8_RES   T1T 1.2  Table 4 */
+typedef struct
+{
+    uint8_t add;                                             /*!< ADD8                      */
+    uint8_t data[RFAL_T1T_BLOCK_LEN];                        /*!< DATA8                     */
+} rfalT1TBlockRes;
+
 /*
 ******************************************************************************
 * LOCAL FUNCTION PROTOTYPES
 ******************************************************************************
 */
+static ReturnCode rfalT1TPollerBlockTxRx( uint8_t cmd, uint8_t* uid, uint8_t add, uint8_t* data, rfalT1TBlockRes *res, uint32_t fwt, SPI* mspiChannel, ST25R3911* mST25, DigitalOut* gpio_cs, InterruptIn* IRQ, DigitalOut* fieldLED_01, DigitalOut* fieldLED_02, DigitalOut* fieldLED_03, DigitalOut* fieldLED_04, DigitalOut* fieldLED_05, DigitalOut* fieldLED_06 );
+
+/*
+******************************************************************************
+* LOCAL FUNCTIONS
+******************************************************************************
+*/
+
+static ReturnCode rfalT1TPollerBlockTxRx( uint8_t cmd, uint8_t* uid, uint8_t add, uint8_t* data, rfalT1TBlockRes *res, uint32_t fwt, SPI* mspiChannel, ST25R3911* mST25, DigitalOut* gpio_cs, InterruptIn* IRQ, DigitalOut* fieldLED_01, DigitalOut* fieldLED_02, DigitalOut* fieldLED_03, DigitalOut* fieldLED_04, DigitalOut* fieldLED_05, DigitalOut* fieldLED_06 )
+{
+    rfalT1TBlockReq req;
+    uint16_t        rxRcvdLen;
+    ReturnCode      ret;
+    
+    if( uid == NULL )
+    {
+        return ERR_PARAM;
+    }
+    
+    req.cmd = cmd;
+    req.add = add;
+    ST_MEMCPY( req.uid, uid, RFAL_T1T_UID_LEN );
+    
+    if( data != NULL )
+    {
+        ST_MEMCPY( req.data, data, RFAL_T1T_BLOCK_LEN );
+    }
+    else
+    {
+        ST_MEMSET( req.data, 0x00, RFAL_T1T_BLOCK_LEN );
+    }
+    
+    EXIT_ON_ERR( ret, rfalTransceiveBlockingTxRx( (uint8_t*)&req, sizeof(rfalT1TBlockReq), (uint8_t*)res, sizeof(rfalT1TBlockRes), &rxRcvdLen, RFAL_TXRX_FLAGS_DEFAULT, fwt, mspiChannel, mST25, gpio_cs, IRQ, fieldLED_01, fieldLED_02, fieldLED_03, fieldLED_04, fieldLED_05, fieldLED_06 ) );
+    
+    if( (rxRcvdLen != sizeof(rfalT1TBlockRes)) || (res->add != add) )
+    {
+        return ERR_PROTO;
+    }
+    
+    return ERR_NONE;
+}
 
 /*
 ******************************************************************************
@@ -218,4 +279,204 @@ ReturnCode rfalT1TPollerWrite( uint8_t* uid, uint8_t address, uint8_t data,SPI*
     return err;
 }
 
+
+/*******************************************************************************/
+ReturnCode rfalT1TPollerRseg( uint8_t* uid, uint8_t segment, uint8_t* rxBuf, uint16_t rxBufLen, uint16_t *rxRcvdLen, SPI* mspiChannel, ST25R3911* mST25, DigitalOut* gpio_cs, InterruptIn* IRQ, DigitalOut* fieldLED_01, DigitalOut* fieldLED_02, DigitalOut* fieldLED_03, DigitalOut* fieldLED_04, DigitalOut* fieldLED_05, DigitalOut* fieldLED_06 )
+{
+    rfalT1TBlockReq rsegReq;
+    ReturnCode      ret;
+    
+    if( (rxBuf == NULL) || (uid == NULL) || (rxRcvdLen == NULL) )
+    {
+        return ERR_PARAM;
+    }
+    
+    /* Compute RSEG command, the segment goes on the ADDS upper nibble */
+    ST_MEMSET( &rsegReq, 0x00, sizeof(rfalT1TBlockReq) );
+    rsegReq.cmd = RFAL_T1T_CMD_RSEG;
+    rsegReq.add = (segment << RFAL_T1T_ADDS_SHIFT);
+    ST_MEMCPY( rsegReq.uid, uid, RFAL_T1T_UID_LEN );
+    
+    EXIT_ON_ERR( ret, rfalTransceiveBlockingTxRx( (uint8_t*)&rsegReq, sizeof(rfalT1TBlockReq), rxBuf, rxBufLen, rxRcvdLen, RFAL_TXRX_FLAGS_DEFAULT, RFAL_T1T_DRD_READ, mspiChannel, mST25, gpio_cs, IRQ, fieldLED_01, fieldLED_02, fieldLED_03, fieldLED_04, fieldLED_05, fieldLED_06 ) );
+    
+    if( (*rxRcvdLen == 0) || (rxBuf[0] != rsegReq.add) )
+    {
+        return ERR_PROTO;
+    }
+    
+    return ERR_NONE;
+}
+
+
+/*******************************************************************************/
+ReturnCode rfalT1TPollerRead8( uint8_t* uid, uint8_t block, uint8_t* data, SPI* mspiChannel, ST25R3911* mST25, DigitalOut* gpio_cs, InterruptIn* IRQ, DigitalOut* fieldLED_01, DigitalOut* fieldLED_02, DigitalOut* fieldLED_03, DigitalOut* fieldLED_04, DigitalOut* fieldLED_05, DigitalOut* fieldLED_06 )
+{
+    rfalT1TBlockRes res;
+    ReturnCode      ret;
+    
+    if( data == NULL )
+    {
+        return ERR_PARAM;
+    }
+    
+    EXIT_ON_ERR( ret, rfalT1TPollerBlockTxRx( RFAL_T1T_CMD_READ8, uid, block, NULL, &res, RFAL_T1T_DRD_READ, mspiChannel, mST25, gpio_cs, IRQ, fieldLED_01, fieldLED_02, fieldLED_03, fieldLED_04, fieldLED_05, fieldLED_06 ) );
+    
+    ST_MEMCPY( data, res.data, RFAL_T1T_BLOCK_LEN );
+    return ERR_NONE;
+}
+
+
+/*******************************************************************************/
+ReturnCode rfalT1TPollerWriteE8( uint8_t* uid, uint8_t block, uint8_t* data, SPI* mspiChannel, ST25R3911* mST25, DigitalOut* gpio_cs, InterruptIn* IRQ, DigitalOut* fieldLED_01, DigitalOut* fieldLED_02, DigitalOut* fieldLED_03, DigitalOut* fieldLED_04, DigitalOut* fieldLED_05, DigitalOut* fieldLED_06 )
+{
+    rfalT1TBlockRes res;
+    ReturnCode      ret;
+    
+    if( data == NULL )
+    {
+        return ERR_PARAM;
+    }
+    
+    EXIT_ON_ERR( ret, rfalT1TPollerBlockTxRx( RFAL_T1T_CMD_WRITE_E8, uid, block, data, &res, RFAL_T1T_DRD_WRITE_E, mspiChannel, mST25, gpio_cs, IRQ, fieldLED_01, fieldLED_02, fieldLED_03, fieldLED_04, fieldLED_05, fieldLED_06 ) );
+    
+    /* The response carries the block content after the write */
+    if( ST_BYTECMP( res.data, data, RFAL_T1T_BLOCK_LEN ) != 0 )
+    {
+        return ERR_PROTO;
+    }
+    
+    return ERR_NONE;
+}
+
+
+/*******************************************************************************/
+ReturnCode rfalT1TPollerWriteNE8( uint8_t* uid, uint8_t block, uint8_t* data, SPI* mspiChannel, ST25R3911* mST25, DigitalOut* gpio_cs, InterruptIn* IRQ, DigitalOut* fieldLED_01, DigitalOut* fieldLED_02, DigitalOut* fieldLED_03, DigitalOut* fieldLED_04, DigitalOut* fieldLED_05, DigitalOut* fieldLED_06 )
+{
+    rfalT1TBlockRes res;
+    uint8_t         i;
+    ReturnCode      ret;
+    
+    if( data == NULL )
+    {
+        return ERR_PARAM;
+    }
+    
+    EXIT_ON_ERR( ret, rfalT1TPollerBlockTxRx( RFAL_T1T_CMD_WRITE_NE8, uid, block, data, &res, RFAL_T1T_DRD_WRITE, mspiChannel, mST25, gpio_cs, IRQ, fieldLED_01, fieldLED_02, fieldLED_03, fieldLED_04, fieldLED_05, fieldLED_06 ) );
+    
+    /* Without erase every bit set on data must be set on the resulting block */
+    for( i = 0; i < RFAL_T1T_BLOCK_LEN; i++ )
+    {
+        if( (res.data[i] & data[i]) != data[i] )
+        {
+            return ERR_PROTO;
+        }
+    }
+    
+    return ERR_NONE;
+}
+
+
+/*******************************************************************************/
+ReturnCode rfalT1TPollerImageRead( uint8_t* uid, uint16_t len, rfalT1TImage *image, SPI* mspiChannel, ST25R3911* mST25, DigitalOut* gpio_cs, InterruptIn* IRQ, DigitalOut* fieldLED_01, DigitalOut* fieldLED_02, DigitalOut* fieldLED_03, DigitalOut* fieldLED_04, DigitalOut* fieldLED_05, DigitalOut* fieldLED_06 )
+{
+    uint8_t    rsegRes[RFAL_T1T_SEGMENT_LEN + 1];
+    uint16_t   rxRcvdLen;
+    uint16_t   pos;
+    uint16_t   cpyLen;
+    ReturnCode ret;
+    
+    if( (uid == NULL) || (image == NULL) || (len == 0) || (len > RFAL_T1T_IMAGE_MAX_LEN) || ((len % RFAL_T1T_BLOCK_LEN) != 0) )
+    {
+        return ERR_PARAM;
+    }
+    
+    ST_MEMCPY( image->uid, uid, RFAL_T1T_UID_LEN );
+    image->len = 0;
+    
+    /* One RSEG per segment, the last one may be partially used */
+    for( pos = 0; pos < len; pos += RFAL_T1T_SEGMENT_LEN )
+    {
+        EXIT_ON_ERR( ret, rfalT1TPollerRseg( uid, (uint8_t)(pos / RFAL_T1T_SEGMENT_LEN), rsegRes, sizeof(rsegRes), &rxRcvdLen, mspiChannel, mST25, gpio_cs, IRQ, fieldLED_01, fieldLED_02, fieldLED_03, fieldLED_04, fieldLED_05, fieldLED_06 ) );
+        
+        if( rxRcvdLen != sizeof(rsegRes) )
+        {
+            return ERR_PROTO;
+        }
+        
+        cpyLen = MIN( RFAL_T1T_SEGMENT_LEN, (len - pos) );
+        ST_MEMCPY( &image->data[pos], &rsegRes[1], cpyLen );
+    }
+    
+    image->len = len;
+    return ERR_NONE;
+}
+
+
+/*******************************************************************************/
+ReturnCode rfalT1TPollerImageWrite( rfalT1TImage *image, const uint8_t* data, uint16_t *blocksWritten, SPI* mspiChannel, ST25R3911* mST25, DigitalOut* gpio_cs, InterruptIn* IRQ, DigitalOut* fieldLED_01, DigitalOut* fieldLED_02, DigitalOut* fieldLED_03, DigitalOut* fieldLED_04, DigitalOut* fieldLED_05, DigitalOut* fieldLED_06 )
+{
+    uint8_t    blk[RFAL_T1T_BLOCK_LEN];
+    uint8_t    *cur;
+    uint16_t   pos;
+    uint8_t    i;
+    bool       isSetOnly;
+    ReturnCode ret;
+    
+    if( (image == NULL) || (data == NULL) )
+    {
+        return ERR_PARAM;
+    }
+    
+    if( blocksWritten != NULL )
+    {
+        *blocksWritten = 0;
+    }
+    
+    for( pos = 0; pos < image->len; pos += RFAL_T1T_BLOCK_LEN )
+    {
+        cur = &image->data[pos];
+        
+        if( ST_BYTECMP( cur, &data[pos], RFAL_T1T_BLOCK_LEN ) == 0 )
+        {
+            continue;
+        }
+        
+        /* A non-erase write can only set bits: usable if no bit goes from 1 to 0 */
+        isSetOnly = true;
+        for( i = 0; i < RFAL_T1T_BLOCK_LEN; i++ )
+        {
+            if( (cur[i] & ~data[pos + i]) != 0 )
+            {
+                isSetOnly = false;
+                break;
+            }
+        }
+        
+        ST_MEMCPY( blk, &data[pos], RFAL_T1T_BLOCK_LEN );
+        
+        if( isSetOnly )
+        {
+            ret = rfalT1TPollerWriteNE8( image->uid, (uint8_t)(pos / RFAL_T1T_BLOCK_LEN), blk, mspiChannel, mST25, gpio_cs, IRQ, fieldLED_01, fieldLED_02, fieldLED_03, fieldLED_04, fieldLED_05, fieldLED_06 );
+        }
+        else
+        {
+            ret = rfalT1TPollerWriteE8( image->uid, (uint8_t)(pos / RFAL_T1T_BLOCK_LEN), blk, mspiChannel, mST25, gpio_cs, IRQ, fieldLED_01, fieldLED_02, fieldLED_03, fieldLED_04, fieldLED_05, fieldLED_06 );
+        }
+        
+        if( ret != ERR_NONE )
+        {
+            return ret;
+        }
+        
+        ST_MEMCPY( cur, blk, RFAL_T1T_BLOCK_LEN );
+        
+        if( blocksWritten != NULL )
+        {
+            (*blocksWritten)++;
+        }
+    }
+    
+    return ERR_NONE;
+}
+
 #endif /* RFAL_FEATURE_T1T */
@@ -73,6 +73,10 @@
 #define RFAL_T1T_HR0_NDEF_MASK      0xF0   /*!< T1T HR0 NDEF capability mask  T1T 1.2 2.2.2 */
 #define RFAL_T1T_HR0_NDEF_SUPPORT   0x10   /*!< T1T HR0 NDEF capable value    T1T 1.2 2.2.2 */
 
+#define RFAL_T1T_BLOCK_LEN             8   /*!< T1T block length                            T1T 1.2 2.1   */
+#define RFAL_T1T_SEGMENT_LEN         128   /*!< T1T segment length: 16 blocks               T1T 1.2 2.1   */
+#define RFAL_T1T_IMAGE_MAX_LEN       512   /*!< T1T tag image max length (Topaz 512)                      */
+
 
 /*! NFC-A T1T (Topaz) command set */
 typedef enum
@@ -81,7 +85,11 @@ typedef enum
     RFAL_T1T_CMD_RALL     = 0x00,          /*!< T1T Read All                                */
     RFAL_T1T_CMD_READ     = 0x01,          /*!< T1T Read                                    */
     RFAL_T1T_CMD_WRITE_E  = 0x53,          /*!< T1T Write with erase (single byte)          */
-    RFAL_T1T_CMD_WRITE_NE = 0x1A           /*!< T1T Write with no erase (single byte)       */
+    RFAL_T1T_CMD_WRITE_NE = 0x1A,          /*!< T1T Write with no erase (single byte)       */
+    RFAL_T1T_CMD_RSEG     = 0x10,          /*!< T1T Read segment (128 bytes)                */
+    RFAL_T1T_CMD_READ8    = 0x02,          /*!< T1T Read block (8 bytes)                    */
+    RFAL_T1T_CMD_WRITE_E8 = 0x54,          /*!< T1T Write with erase (8 bytes block)        */
+    RFAL_T1T_CMD_WRITE_NE8= 0x1B           /*!< T1T Write with no erase (8 bytes block)     */
 } rfalT1Tcmds;
 
 
@@ -100,6 +108,15 @@ typedef struct
     uint8_t uid[RFAL_T1T_UID_LEN];         /*!< T1T UID                                     */
 } rfalT1TRidRes;
 
+
+/*! T1T tag image: last known content of the tag memory from block 0 */
+typedef struct
+{
+    uint8_t  uid[RFAL_T1T_UID_LEN];        /*!< T1T UID                                     */
+    uint16_t len;                          /*!< Image length, multiple of RFAL_T1T_BLOCK_LEN */
+    uint8_t  data[RFAL_T1T_IMAGE_MAX_LEN]; /*!< Tag memory                                  */
+} rfalT1TImage;
+
 /*
 ******************************************************************************
 * GLOBAL FUNCTION PROTOTYPES
@@ -176,6 +193,138 @@ ReturnCode rfalT1TPollerRall( uint8_t* uid, uint8_t* rxBuf, uint16_t rxBufLen, u
  */
 ReturnCode rfalT1TPollerWrite( uint8_t* uid, uint8_t address, uint8_t data,SPI* mspiChannel, ST25R3911* mST25, DigitalOut* gpio_cs, InterruptIn* IRQ, DigitalOut* fieldLED_01, DigitalOut* fieldLED_02, DigitalOut* fieldLED_03, DigitalOut* fieldLED_04, DigitalOut* fieldLED_05, DigitalOut* fieldLED_06 );
 
+
+/*!
+ *****************************************************************************
+ * \brief  NFC-A T1T Poller RSEG
+ *
+ * This method reads a whole segment (128 bytes) of a NFC-A T1T Listener 
+ * device with dynamic memory
+ *
+ *
+ * \param[in]   uid       : the UID of the device to read data
+ * \param[in]   segment   : segment to be read
+ * \param[out]  rxBuf     : pointer to place the read data (ADDS and segment)
+ * \param[in]   rxBufLen  : size of rxBuf
+ * \param[out]  rxRcvdLen : actual received data
+ *
+ * \return ERR_WRONG_STATE  : RFAL not initialized or mode not set
+ * \return ERR_PARAM        : Invalid parameter
+ * \return ERR_PROTO        : Protocol error
+ * \return ERR_NONE         : No error
+ *****************************************************************************
+ */
+ReturnCode rfalT1TPollerRseg( uint8_t* uid, uint8_t segment, uint8_t* rxBuf, uint16_t rxBufLen, uint16_t *rxRcvdLen, SPI* mspiChannel, ST25R3911* mST25, DigitalOut* gpio_cs, InterruptIn* IRQ, DigitalOut* fieldLED_01, DigitalOut* fieldLED_02, DigitalOut* fieldLED_03, DigitalOut* fieldLED_04, DigitalOut* fieldLED_05, DigitalOut* fieldLED_06 );
+
+
+/*!
+ *****************************************************************************
+ * \brief  NFC-A T1T Poller READ8
+ *
+ * This method reads one 8 bytes block of a NFC-A T1T Listener device 
+ * with dynamic memory
+ *
+ *
+ * \param[in]   uid       : the UID of the device to read data
+ * \param[in]   block     : block to be read
+ * \param[out]  data      : pointer to place the RFAL_T1T_BLOCK_LEN bytes read
+ *
+ * \return ERR_WRONG_STATE  : RFAL not initialized or mode not set
+ * \return ERR_PARAM        : Invalid parameter
+ * \return ERR_PROTO        : Protocol error
+ * \return ERR_NONE         : No error
+ *****************************************************************************
+ */
+ReturnCode rfalT1TPollerRead8( uint8_t* uid, uint8_t block, uint8_t* data, SPI* mspiChannel, ST25R3911* mST25, DigitalOut* gpio_cs, InterruptIn* IRQ, DigitalOut* fieldLED_01, DigitalOut* fieldLED_02, DigitalOut* fieldLED_03, DigitalOut* fieldLED_04, DigitalOut* fieldLED_05, DigitalOut* fieldLED_06 );
+
+
+/*!
+ *****************************************************************************
+ * \brief  NFC-A T1T Poller WRITE-E8
+ *
+ * This method erases and writes one 8 bytes block of a NFC-A T1T Listener
+ * device with dynamic memory
+ *
+ *
+ * \param[in]   uid       : the UID of the device to write data
+ * \param[in]   block     : block to be written
+ * \param[in]   data      : the RFAL_T1T_BLOCK_LEN bytes to be written
+ *
+ * \return ERR_WRONG_STATE  : RFAL not initialized or mode not set
+ * \return ERR_PARAM        : Invalid parameter
+ * \return ERR_PROTO        : Protocol error
+ * \return ERR_NONE         : No error
+ *****************************************************************************
+ */
+ReturnCode rfalT1TPollerWriteE8( uint8_t* uid, uint8_t block, uint8_t* data, SPI* mspiChannel, ST25R3911* mST25, DigitalOut* gpio_cs, InterruptIn* IRQ, DigitalOut* fieldLED_01, DigitalOut* fieldLED_02, DigitalOut* fieldLED_03, DigitalOut* fieldLED_04, DigitalOut* fieldLED_05, DigitalOut* fieldLED_06 );
+
+
+/*!
+ *****************************************************************************
+ * \brief  NFC-A T1T Poller WRITE-NE8
+ *
+ * This method writes one 8 bytes block of a NFC-A T1T Listener device
+ * with dynamic memory without erasing it: bits can only be set, the 
+ * resulting block is the OR of its previous content and data
+ *
+ *
+ * \param[in]   uid       : the UID of the device to write data
+ * \param[in]   block     : block to be written
+ * \param[in]   data      : the RFAL_T1T_BLOCK_LEN bytes to be written
+ *
+ * \return ERR_WRONG_STATE  : RFAL not initialized or mode not set
+ * \return ERR_PARAM        : Invalid parameter
+ * \return ERR_PROTO        : Protocol error
+ * \return ERR_NONE         : No error
+ *****************************************************************************
+ */
+ReturnCode rfalT1TPollerWriteNE8( uint8_t* uid, uint8_t block, uint8_t* data, SPI* mspiChannel, ST25R3911* mST25, DigitalOut* gpio_cs, InterruptIn* IRQ, DigitalOut* fieldLED_01, DigitalOut* fieldLED_02, DigitalOut* fieldLED_03, DigitalOut* fieldLED_04, DigitalOut* fieldLED_05, DigitalOut* fieldLED_06 );
+
+
+/*!
+ *****************************************************************************
+ * \brief  NFC-A T1T Poller Image Read
+ *
+ * This method reads the first len bytes of a NFC-A T1T Listener device 
+ * with dynamic memory into the given image, one segment per RSEG
+ *
+ *
+ * \param[in]   uid       : the UID of the device to read data
+ * \param[in]   len       : number of bytes to read, multiple of RFAL_T1T_BLOCK_LEN
+ * \param[out]  image     : tag image to be filled
+ *
+ * \return ERR_WRONG_STATE  : RFAL not initialized or mode not set
+ * \return ERR_PARAM        : Invalid parameter
+ * \return ERR_PROTO        : Protocol error
+ * \return ERR_NONE         : No error
+ *****************************************************************************
+ */
+ReturnCode rfalT1TPollerImageRead( uint8_t* uid, uint16_t len, rfalT1TImage *image, SPI* mspiChannel, ST25R3911* mST25, DigitalOut* gpio_cs, InterruptIn* IRQ, DigitalOut* fieldLED_01, DigitalOut* fieldLED_02, DigitalOut* fieldLED_03, DigitalOut* fieldLED_04, DigitalOut* fieldLED_05, DigitalOut* fieldLED_06 );
+
+
+/*!
+ *****************************************************************************
+ * \brief  NFC-A T1T Poller Image Write
+ *
+ * This method writes the given data on a NFC-A T1T Listener device, only
+ * the blocks that differ from the image are written. A block whose 
+ * change only sets bits is written with WRITE-NE8, which takes half the 
+ * time of WRITE-E8. The image is updated as the blocks are written, 
+ * upon error it must be read again
+ *
+ *
+ * \param[in,out] image         : tag image, as read by rfalT1TPollerImageRead()
+ * \param[in]     data          : new content, image->len bytes from block 0
+ * \param[out]    blocksWritten : number of blocks written, may be NULL
+ *
+ * \return ERR_WRONG_STATE  : RFAL not initialized or mode not set
+ * \return ERR_PARAM        : Invalid parameter
+ * \return ERR_PROTO        : Protocol error
+ * \return ERR_NONE         : No error
+ *****************************************************************************
+ */
+ReturnCode rfalT1TPollerImageWrite( rfalT1TImage *image, const uint8_t* data, uint16_t *blocksWritten, SPI* mspiChannel, ST25R3911* mST25, DigitalOut* gpio_cs, InterruptIn* IRQ, DigitalOut* fieldLED_01, DigitalOut* fieldLED_02, DigitalOut* fieldLED_03, DigitalOut* fieldLED_04, DigitalOut* fieldLED_05, DigitalOut* fieldLED_06 );
+
 #endif /* RFAL_T1T_H */
 
 /**
@@ -0,0 +1,470 @@
+/******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT 2016 STMicroelectronics</center></h2>
+  *
+  * Licensed under ST MYLIBERTY SOFTWARE LICENSE AGREEMENT (the "License");
+  * You may not use this file except in compliance with the License.
+  * You may obtain a copy of the License at:
+  *
+  *        http://www.st.com/myliberty
+  *
+  * Unless required by applicable law or agreed to in writing, software 
+  * distributed under the License is distributed on an "AS IS" BASIS, 
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied,
+  * AND SPECIFICALLY DISCLAIMING THE IMPLIED WARRANTIES OF MERCHANTABILITY,
+  * FITNESS FOR A PARTICULAR PURPOSE, AND NON-INFRINGEMENT.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+******************************************************************************/
+
+/*
+ *      PROJECT:   ST25R391x firmware
+ *      $Revision: $
+ *      LANGUAGE:  ISO C99
+ */
+
+/*! \file rfal_t2t.c
+ *
+ *  \brief Provides NFC-A T2T convenience methods and definitions
+ *  
+ *  This module provides an interface to perform as a NFC-A Reader/Writer
+ *  to handle a Type 2 Tag T2T (NTAG / Ultralight)
+ *  
+ */
+
+/*
+ ******************************************************************************
+ * INCLUDES
+ ******************************************************************************
+ */
+#include "rfal_t2t.h"
+#include "utils.h"
+#include "platform1.h"
+
+/*
+ ******************************************************************************
+ * ENABLE SWITCH
+ ******************************************************************************
+ */
+
+#ifndef RFAL_FEATURE_T2T
+    #error " RFAL: Module configuration missing. Please enable/disable T2T module by setting: RFAL_FEATURE_T2T "
+#endif
+
+#if RFAL_FEATURE_T2T
+
+/*
+ ******************************************************************************
+ * GLOBAL DEFINES
+ ******************************************************************************
+ */
+
+#define RFAL_T2T_FWT_READ           rfalConvMsTo1fc(5)  /*!< Response timeout for READ and the other read commands  T2T 1.0 4.3 */
+#define RFAL_T2T_FWT_WRITE          rfalConvMsTo1fc(10) /*!< ACK timeout for WRITE and COMPATIBILITY_WRITE          T2T 1.0 4.3 */
+
+#define RFAL_T2T_ACK                0x0A                /*!< T2T 4 bit ACK                                      T2T 1.0 4.3 */
+#define RFAL_T2T_ACK_NAK_MASK       0x0F                /*!< T2T 4 bit ACK/NAK mask                             T2T 1.0 4.3 */
+
+#define RFAL_T2T_READ_SIG_ADD       0x00                /*!< READ_SIG address, RFU and set to 0x00                          */
+
+
+/*
+******************************************************************************
+* GLOBAL MACROS
+******************************************************************************
+*/
+
+/*! Checks if the given error is a 4 bit ACK/NAK reception */
+#define rfalT2TIsAckNak( e )        ((ERR_NO_MASK(e) >= ERR_INCOMPLETE_BYTE) && (ERR_NO_MASK(e) <= ERR_INCOMPLETE_BYTE_07))
+
+/*
+******************************************************************************
+* GLOBAL TYPES
+******************************************************************************
+*/
+
+/*! NFC-A T2T READ_REQ  T2T 1.0 5.1 */
+typedef struct
+{
+    uint8_t cmd;                                             /*!< T2T cmd: READ             */
+    uint8_t page;                                            /*!< Page number               */
+} rfalT2TReadReq;
+
+
+/*! NFC-A T2T FAST_READ_REQ */
+typedef struct
+{
+    uint8_t cmd;                                             /*!< T2T cmd: FAST_READ        */
+    uint8_t startPage;                                       /*!< First page                */
+    uint8_t endPage;                                         /*!< Last page                 */
+} rfalT2TFastReadReq;
+
+
+/*! NFC-A T2T WRITE_REQ  T2T 1.0 5.2 */
+typedef struct
+{
+    uint8_t cmd;                                             /*!< T2T cmd: WRITE            */
+    uint8_t page;                                            /*!< Page number               */
+    uint8_t data[RFAL_T2T_WRITE_DATA_LEN];                   /*!< Page data                 */
+} rfalT2TWriteReq;
+
+
+/*! T2T page cache, one bit per page tells whether the page is cached */
+typedef struct
+{
+    bool    isBound;                                         /*!< Cache bound to a device   */
+    uint8_t uidLen;                                          /*!< UID length                */
+    uint8_t uid[RFAL_NFCA_CASCADE_3_UID_LEN];                /*!< UID of the bound device   */
+    uint16_t memPages;                                       /*!< Pages on the device, 0 if unknown */
+    uint8_t valid[RFAL_T2T_CACHE_PAGES / 8];                 /*!< Cached pages bitmap       */
+    uint8_t data[RFAL_T2T_CACHE_PAGES * RFAL_T2T_PAGE_LEN];  /*!< Cached pages data         */
+} rfalT2TCache;
+
+/*
+******************************************************************************
+* LOCAL FUNCTION PROTOTYPES
+******************************************************************************
+*/
+static bool rfalT2TCacheGet( uint8_t page, uint16_t pageCnt, uint8_t *buf );
+static void rfalT2TCacheSet( uint8_t page, uint16_t pageCnt, const uint8_t *buf );
+static void rfalT2TCacheDrop( uint8_t page );
+static ReturnCode rfalT2TAckTxRx( uint8_t *txBuf, uint16_t txBufLen, SPI* mspiChannel, ST25R3911* mST25, DigitalOut* gpio_cs, InterruptIn* IRQ, DigitalOut* fieldLED_01, DigitalOut* fieldLED_02, DigitalOut* fieldLED_03, DigitalOut* fieldLED_04, DigitalOut* fieldLED_05, DigitalOut* fieldLED_06 );
+
+/*
+******************************************************************************
+* LOCAL VARIABLES
+******************************************************************************
+*/
+static rfalT2TCache gRfalT2TCache;    /*!< Page cache of the bound device */
+
+/*
+******************************************************************************
+* LOCAL FUNCTIONS
+******************************************************************************
+*/
+
+static bool rfalT2TCacheGet( uint8_t page, uint16_t pageCnt, uint8_t *buf )
+{
+    uint16_t i;
+    
+    if( !gRfalT2TCache.isBound || ((page + pageCnt) > RFAL_T2T_CACHE_PAGES) )
+    {
+        return false;
+    }
+    
+    for( i = page; i < (page + pageCnt); i++ )
+    {
+        if( (gRfalT2TCache.valid[i / 8] & (1 << (i % 8))) == 0 )
+        {
+            return false;
+        }
+    }
+    
+    ST_MEMCPY( buf, &gRfalT2TCache.data[page * RFAL_T2T_PAGE_LEN], (pageCnt * RFAL_T2T_PAGE_LEN) );
+    return true;
+}
+
+
+/*******************************************************************************/
+static void rfalT2TCacheSet( uint8_t page, uint16_t pageCnt, const uint8_t *buf )
+{
+    uint16_t i;
+    
+    if( !gRfalT2TCache.isBound )
+    {
+        return;
+    }
+    
+    for( i = page; (i < (page + pageCnt)) && (i < RFAL_T2T_CACHE_PAGES); i++ )
+    {
+        ST_MEMCPY( &gRfalT2TCache.data[i * RFAL_T2T_PAGE_LEN], &buf[(i - page) * RFAL_T2T_PAGE_LEN], RFAL_T2T_PAGE_LEN );
+        gRfalT2TCache.valid[i / 8] |= (1 << (i % 8));
+    }
+}
+
+
+/*******************************************************************************/
+static void rfalT2TCacheDrop( uint8_t page )
+{
+    if( page < RFAL_T2T_CACHE_PAGES )
+    {
+        gRfalT2TCache.valid[page / 8] &= ~(1 << (page % 8));
+    }
+}
+
+
+/*******************************************************************************/
+static ReturnCode rfalT2TAckTxRx( uint8_t *txBuf, uint16_t txBufLen, SPI* mspiChannel, ST25R3911* mST25, DigitalOut* gpio_cs, InterruptIn* IRQ, DigitalOut* fieldLED_01, DigitalOut* fieldLED_02, DigitalOut* fieldLED_03, DigitalOut* fieldLED_04, DigitalOut* fieldLED_05, DigitalOut* fieldLED_06 )
+{
+    ReturnCode ret;
+    uint8_t    ackNak;
+    uint16_t   rcvLen;
+    
+    ackNak = 0;
+    ret    = rfalTransceiveBlockingTxRx( txBuf, txBufLen, &ackNak, sizeof(ackNak), &rcvLen, RFAL_TXRX_FLAGS_DEFAULT, RFAL_T2T_FWT_WRITE, mspiChannel, mST25, gpio_cs, IRQ, fieldLED_01, fieldLED_02, fieldLED_03, fieldLED_04, fieldLED_05, fieldLED_06 );
+    
+    /* The ACK/NAK is a 4 bit frame without CRC, delivered as an incomplete byte  T2T 1.0 4.3 */
+    if( !rfalT2TIsAckNak( ret ) )
+    {
+        return ((ret == ERR_NONE) ? ERR_PROTO : ret);
+    }
+    
+    return (((ackNak & RFAL_T2T_ACK_NAK_MASK) == RFAL_T2T_ACK) ? ERR_NONE : ERR_PROTO);
+}
+
+
+/*
+******************************************************************************
+* GLOBAL FUNCTIONS
+******************************************************************************
+*/
+
+ReturnCode rfalT2TPollerRead( uint8_t page, uint8_t* rxBuf, uint16_t rxBufLen, uint16_t *rcvLen, SPI* mspiChannel, ST25R3911* mST25, DigitalOut* gpio_cs, InterruptIn* IRQ, DigitalOut* fieldLED_01, DigitalOut* fieldLED_02, DigitalOut* fieldLED_03, DigitalOut* fieldLED_04, DigitalOut* fieldLED_05, DigitalOut* fieldLED_06 )
+{
+    ReturnCode     ret;
+    rfalT2TReadReq req;
+    
+    if( (rxBuf == NULL) || (rcvLen == NULL) || (rxBufLen < RFAL_T2T_READ_DATA_LEN) )
+    {
+        return ERR_PARAM;
+    }
+    
+    if( rfalT2TCacheGet( page, (RFAL_T2T_READ_DATA_LEN / RFAL_T2T_PAGE_LEN), rxBuf ) )
+    {
+        *rcvLen = RFAL_T2T_READ_DATA_LEN;
+        return ERR_NONE;
+    }
+    
+    req.cmd  = RFAL_T2T_CMD_READ;
+    req.page = page;
+    
+    ret = rfalTransceiveBlockingTxRx( (uint8_t*)&req, sizeof(rfalT2TReadReq), rxBuf, RFAL_T2T_READ_DATA_LEN, rcvLen, RFAL_TXRX_FLAGS_DEFAULT, RFAL_T2T_FWT_READ, mspiChannel, mST25, gpio_cs, IRQ, fieldLED_01, fieldLED_02, fieldLED_03, fieldLED_04, fieldLED_05, fieldLED_06 );
+    
+    /* A NAK is answered instead of the data on an invalid page  T2T 1.0 5.1 */
+    if( rfalT2TIsAckNak( ret ) )
+    {
+        return ERR_PROTO;
+    }
+    if( ret != ERR_NONE )
+    {
+        return ret;
+    }
+    
+    if( *rcvLen != RFAL_T2T_READ_DATA_LEN )
+    {
+        return ERR_PROTO;
+    }
+    
+    /* READ rolls over at the end of memory: only the pages known to exist are cached, the 1st one does as it wasn't NAKed */
+    if( gRfalT2TCache.memPages == 0 )
+    {
+        rfalT2TCacheSet( page, 1, rxBuf );
+    }
+    else if( page < gRfalT2TCache.memPages )
+    {
+        rfalT2TCacheSet( page, MIN( (RFAL_T2T_READ_DATA_LEN / RFAL_T2T_PAGE_LEN), (gRfalT2TCache.memPages - page) ), rxBuf );
+    }
+    return ERR_NONE;
+}
+
+
+/*******************************************************************************/
+ReturnCode rfalT2TPollerFastRead( uint8_t startPage, uint8_t endPage, uint8_t* rxBuf, uint16_t rxBufLen, uint16_t *rcvLen, SPI* mspiChannel, ST25R3911* mST25, DigitalOut* gpio_cs, InterruptIn* IRQ, DigitalOut* fieldLED_01, DigitalOut* fieldLED_02, DigitalOut* fieldLED_03, DigitalOut* fieldLED_04, DigitalOut* fieldLED_05, DigitalOut* fieldLED_06 )
+{
+    ReturnCode         ret;
+    rfalT2TFastReadReq req;
+    uint16_t           pageCnt;
+    
+    if( (rxBuf == NULL) || (rcvLen == NULL) || (endPage < startPage) )
+    {
+        return ERR_PARAM;
+    }
+    
+    pageCnt = ((uint16_t)endPage - startPage + 1);
+    if( pageCnt > RFAL_T2T_FAST_READ_MAX_PAGES )
+    {
+        return ERR_PARAM;
+    }
+    
+    if( rxBufLen < (pageCnt * RFAL_T2T_PAGE_LEN) )
+    {
+        return ERR_NOMEM;
+    }
+    
+    if( rfalT2TCacheGet( startPage, pageCnt, rxBuf ) )
+    {
+        *rcvLen = (pageCnt * RFAL_T2T_PAGE_LEN);
+        return ERR_NONE;
+    }
+    
+    req.cmd       = RFAL_T2T_CMD_FAST_READ;
+    req.startPage = startPage;
+    req.endPage   = endPage;
+    
+    ret = rfalTransceiveBlockingTxRx( (uint8_t*)&req, sizeof(rfalT2TFastReadReq), rxBuf, (pageCnt * RFAL_T2T_PAGE_LEN), rcvLen, RFAL_TXRX_FLAGS_DEFAULT, RFAL_T2T_FWT_READ, mspiChannel, mST25, gpio_cs, IRQ, fieldLED_01, fieldLED_02, fieldLED_03, fieldLED_04, fieldLED_05, fieldLED_06 );
+    
+    if( rfalT2TIsAckNak( ret ) )
+    {
+        return ERR_PROTO;
+    }
+    if( ret != ERR_NONE )
+    {
+        return ret;
+    }
+    
+    if( *rcvLen != (pageCnt * RFAL_T2T_PAGE_LEN) )
+    {
+        return ERR_PROTO;
+    }
+    
+    rfalT2TCacheSet( startPage, pageCnt, rxBuf );
+    return ERR_NONE;
+}
+
+
+/*******************************************************************************/
+ReturnCode rfalT2TPollerWrite( uint8_t page, const uint8_t* wrData, SPI* mspiChannel, ST25R3911* mST25, DigitalOut* gpio_cs, InterruptIn* IRQ, DigitalOut* fieldLED_01, DigitalOut* fieldLED_02, DigitalOut* fieldLED_03, DigitalOut* fieldLED_04, DigitalOut* fieldLED_05, DigitalOut* fieldLED_06 )
+{
+    rfalT2TWriteReq req;
+    
+    if( wrData == NULL )
+    {
+        return ERR_PARAM;
+    }
+    
+    req.cmd  = RFAL_T2T_CMD_WRITE;
+    req.page = page;
+    ST_MEMCPY( req.data, wrData, RFAL_T2T_WRITE_DATA_LEN );
+    
+    /* A page may not read back as written (OR-ed lock/OTP bytes, PWD/PACK read *
+     * as 0x00) and without ACK its content is unknown: drop it on any write    */
+    rfalT2TCacheDrop( page );
+    
+    return rfalT2TAckTxRx( (uint8_t*)&req, sizeof(rfalT2TWriteReq), mspiChannel, mST25, gpio_cs, IRQ, fieldLED_01, fieldLED_02, fieldLED_03, fieldLED_04, fieldLED_05, fieldLED_06 );
+}
+
+
+/*******************************************************************************/
+ReturnCode rfalT2TPollerCompatibilityWrite( uint8_t page, const uint8_t* wrData, SPI* mspiChannel, ST25R3911* mST25, DigitalOut* gpio_cs, InterruptIn* IRQ, DigitalOut* fieldLED_01, DigitalOut* fieldLED_02, DigitalOut* fieldLED_03, DigitalOut* fieldLED_04, DigitalOut* fieldLED_05, DigitalOut* fieldLED_06 )
+{
+    ReturnCode ret;
+    uint8_t    buf[RFAL_T2T_COMP_WRITE_DATA_LEN];
+    
+    if( wrData == NULL )
+    {
+        return ERR_PARAM;
+    }
+    
+    /* 1st frame: command and address, acknowledged by the tag */
+    buf[0] = RFAL_T2T_CMD_COMP_WRITE;
+    buf[1] = page;
+    EXIT_ON_ERR( ret, rfalT2TAckTxRx( buf, 2, mspiChannel, mST25, gpio_cs, IRQ, fieldLED_01, fieldLED_02, fieldLED_03, fieldLED_04, fieldLED_05, fieldLED_06 ) );
+    
+    /* 2nd frame: 16 bytes of which only the 1st page is written */
+    ST_MEMSET( buf, 0x00, RFAL_T2T_COMP_WRITE_DATA_LEN );
+    ST_MEMCPY( buf, wrData, RFAL_T2T_WRITE_DATA_LEN );
+    
+    /* Same as WRITE, the written page is no longer cached */
+    rfalT2TCacheDrop( page );
+    
+    return rfalT2TAckTxRx( buf, RFAL_T2T_COMP_WRITE_DATA_LEN, mspiChannel, mST25, gpio_cs, IRQ, fieldLED_01, fieldLED_02, fieldLED_03, fieldLED_04, fieldLED_05, fieldLED_06 );
+}
+
+
+/*******************************************************************************/
+ReturnCode rfalT2TPollerGetVersion( rfalT2TVersion *version, SPI* mspiChannel, ST25R3911* mST25, DigitalOut* gpio_cs, InterruptIn* IRQ, DigitalOut* fieldLED_01, DigitalOut* fieldLED_02, DigitalOut* fieldLED_03, DigitalOut* fieldLED_04, DigitalOut* fieldLED_05, DigitalOut* fieldLED_06 )
+{
+    ReturnCode ret;
+    uint8_t    cmd;
+    uint16_t   rcvLen;
+    
+    if( version == NULL )
+    {
+        return ERR_PARAM;
+    }
+    
+    cmd = RFAL_T2T_CMD_GET_VERSION;
+    ret = rfalTransceiveBlockingTxRx( &cmd, sizeof(cmd), (uint8_t*)version, sizeof(rfalT2TVersion), &rcvLen, RFAL_TXRX_FLAGS_DEFAULT, RFAL_T2T_FWT_READ, mspiChannel, mST25, gpio_cs, IRQ, fieldLED_01, fieldLED_02, fieldLED_03, fieldLED_04, fieldLED_05, fieldLED_06 );
+    
+    if( rfalT2TIsAckNak( ret ) )
+    {
+        return ERR_PROTO;
+    }
+    if( ret != ERR_NONE )
+    {
+        return ret;
+    }
+    
+    return ((rcvLen == sizeof(rfalT2TVersion)) ? ERR_NONE : ERR_PROTO);
+}
+
+
+/*******************************************************************************/
+ReturnCode rfalT2TPollerReadSignature( uint8_t *signature, SPI* mspiChannel, ST25R3911* mST25, DigitalOut* gpio_cs, InterruptIn* IRQ, DigitalOut* fieldLED_01, DigitalOut* fieldLED_02, DigitalOut* fieldLED_03, DigitalOut* fieldLED_04, DigitalOut* fieldLED_05, DigitalOut* fieldLED_06 )
+{
+    ReturnCode ret;
+    uint8_t    req[2];
+    uint16_t   rcvLen;
+    
+    if( signature == NULL )
+    {
+        return ERR_PARAM;
+    }
+    
+    req[0] = RFAL_T2T_CMD_READ_SIG;
+    req[1] = RFAL_T2T_READ_SIG_ADD;
+    ret    = rfalTransceiveBlockingTxRx( req, sizeof(req), signature, RFAL_T2T_SIGNATURE_LEN, &rcvLen, RFAL_TXRX_FLAGS_DEFAULT, RFAL_T2T_FWT_READ, mspiChannel, mST25, gpio_cs, IRQ, fieldLED_01, fieldLED_02, fieldLED_03, fieldLED_04, fieldLED_05, fieldLED_06 );
+    
+    if( rfalT2TIsAckNak( ret ) )
+    {
+        return ERR_PROTO;
+    }
+    if( ret != ERR_NONE )
+    {
+        return ret;
+    }
+    
+    return ((rcvLen == RFAL_T2T_SIGNATURE_LEN) ? ERR_NONE : ERR_PROTO);
+}
+
+
+/*******************************************************************************/
+ReturnCode rfalT2TCacheBind( const uint8_t *uid, uint8_t uidLen, uint16_t memPages )
+{
+    if( uid == NULL )
+    {
+        ST_MEMSET( (uint8_t*)&gRfalT2TCache, 0x00, sizeof(rfalT2TCache) );
+        return ERR_NONE;
+    }
+    
+    if( (uidLen == 0) || (uidLen > RFAL_NFCA_CASCADE_3_UID_LEN) )
+    {
+        return ERR_PARAM;
+    }
+    
+    /* Same device: keep what has already been read */
+    if( gRfalT2TCache.isBound && (gRfalT2TCache.uidLen == uidLen) && (ST_BYTECMP( gRfalT2TCache.uid, uid, uidLen ) == 0) )
+    {
+        gRfalT2TCache.memPages = memPages;
+        return ERR_NONE;
+    }
+    
+    ST_MEMSET( (uint8_t*)&gRfalT2TCache, 0x00, sizeof(rfalT2TCache) );
+    ST_MEMCPY( gRfalT2TCache.uid, uid, uidLen );
+    gRfalT2TCache.uidLen   = uidLen;
+    gRfalT2TCache.memPages = memPages;
+    gRfalT2TCache.isBound  = true;
+    
+    return ERR_NONE;
+}
+
+
+/*******************************************************************************/
+void rfalT2TCacheInvalidate( void )
+{
+    ST_MEMSET( gRfalT2TCache.valid, 0x00, sizeof(gRfalT2TCache.valid) );
+}
+
+#endif /* RFAL_FEATURE_T2T */
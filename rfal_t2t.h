@@ -0,0 +1,283 @@
+/******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT 2016 STMicroelectronics</center></h2>
+  *
+  * Licensed under ST MYLIBERTY SOFTWARE LICENSE AGREEMENT (the "License");
+  * You may not use this file except in compliance with the License.
+  * You may obtain a copy of the License at:
+  *
+  *        http://www.st.com/myliberty
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied,
+  * AND SPECIFICALLY DISCLAIMING THE IMPLIED WARRANTIES OF MERCHANTABILITY,
+  * FITNESS FOR A PARTICULAR PURPOSE, AND NON-INFRINGEMENT.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+******************************************************************************/
+
+/*
+ *      PROJECT:   ST25R391x firmware
+ *      $Revision: $
+ *      LANGUAGE:  ISO C99
+ */
+
+/*! \file rfal_t2t.h
+ *
+ *  \brief Provides NFC-A T2T convenience methods and definitions
+ *
+ *  This module provides an interface to perform as a NFC-A Reader/Writer
+ *  to handle a Type 2 Tag T2T (NTAG / Ultralight)
+ *
+ *  Pages read from the tag bound to the page cache are kept, so that 
+ *  further reads of the same pages (CC, NDEF TLV header) are served 
+ *  without any exchange. Writes keep the cache coherent by dropping the
+ *  written page: lock, OTP, PWD or PACK pages don't read back as written
+ *
+ *
+ * @addtogroup RFAL
+ * @{
+ *
+ * @addtogroup RFAL-AL
+ * @brief RFAL Abstraction Layer
+ * @{
+ *
+ * @addtogroup T2T
+ * @brief RFAL T2T Module
+ * @{
+ *
+ */
+
+
+#ifndef RFAL_T2T_H
+#define RFAL_T2T_H
+
+/*
+ ******************************************************************************
+ * INCLUDES
+ ******************************************************************************
+ */
+#include "platform1.h"
+#include "st_errno.h"
+#include "rfal_rf.h"
+#include "rfal_nfca.h"
+
+/*
+ ******************************************************************************
+ * GLOBAL DEFINES
+ ******************************************************************************
+ */
+#define RFAL_T2T_PAGE_LEN                 4   /*!< T2T page (block) length                              T2T 1.0 2.1    */
+#define RFAL_T2T_READ_DATA_LEN           16   /*!< T2T READ response data length: 4 pages               T2T 1.0 5.1    */
+#define RFAL_T2T_WRITE_DATA_LEN           4   /*!< T2T WRITE data length: 1 page                        T2T 1.0 5.2    */
+#define RFAL_T2T_COMP_WRITE_DATA_LEN     16   /*!< COMPATIBILITY_WRITE data length, only 1st page written             */
+#define RFAL_T2T_SIGNATURE_LEN           32   /*!< READ_SIG originality signature length (NTAG21x)                    */
+
+#define RFAL_T2T_FAST_READ_MAX_PAGES    256   /*!< Max pages on a single FAST_READ, a whole sector. The RF layer 
+                                                   drains the FIFO on each water level so the frame is only 
+                                                   bound by the Rx buffer: a full NTAG216 (231 pages) is one frame */
+#define RFAL_T2T_CACHE_PAGES             64   /*!< Pages kept by the page cache, from page 0                          */
+
+
+/*! NFC-A T2T command set   T2T 1.0 5 & NTAG21x */
+typedef enum
+{
+    RFAL_T2T_CMD_READ                = 0x30,  /*!< T2T Read 4 pages                              */
+    RFAL_T2T_CMD_WRITE               = 0xA2,  /*!< T2T Write 1 page                              */
+    RFAL_T2T_CMD_COMP_WRITE          = 0xA0,  /*!< Compatibility Write 1 page in a 16 bytes frame */
+    RFAL_T2T_CMD_FAST_READ           = 0x3A,  /*!< Read a page range on a single frame          */
+    RFAL_T2T_CMD_GET_VERSION         = 0x60,  /*!< Get product version                          */
+    RFAL_T2T_CMD_READ_SIG            = 0x3C   /*!< Read originality signature                   */
+} rfalT2Tcmds;
+
+
+/*
+******************************************************************************
+* GLOBAL TYPES
+******************************************************************************
+*/
+
+/*! NFC-A T2T GET_VERSION response (NTAG21x / Ultralight EV1) */
+typedef struct
+{
+    uint8_t header;                           /*!< Fixed header                                 */
+    uint8_t vendorId;                         /*!< Vendor ID                                    */
+    uint8_t productType;                      /*!< Product type                                 */
+    uint8_t productSubtype;                   /*!< Product subtype                              */
+    uint8_t majorVersion;                     /*!< Major product version                        */
+    uint8_t minorVersion;                     /*!< Minor product version                        */
+    uint8_t storageSize;                      /*!< Storage size                                 */
+    uint8_t protocolType;                     /*!< Protocol type                                */
+} rfalT2TVersion;
+
+/*
+******************************************************************************
+* GLOBAL FUNCTION PROTOTYPES
+******************************************************************************
+*/
+
+
+/*!
+ *****************************************************************************
+ * \brief  NFC-A T2T Poller Read
+ *
+ * This method reads 4 pages (16 bytes) starting on the given page of a 
+ * NFC-A T2T Listener device. Pages found on the page cache are not read 
+ * again
+ *
+ * \param[in]   page      : first page to be read
+ * \param[out]  rxBuf     : pointer to place the read data
+ * \param[in]   rxBufLen  : size of rxBuf, at least RFAL_T2T_READ_DATA_LEN
+ * \param[out]  rcvLen    : actual received data
+ *
+ * \return ERR_WRONG_STATE  : RFAL not initialized or mode not set
+ * \return ERR_PARAM        : Invalid parameter
+ * \return ERR_PROTO        : Protocol error, NAK received
+ * \return ERR_NONE         : No error
+ *****************************************************************************
+ */
+ReturnCode rfalT2TPollerRead( uint8_t page, uint8_t* rxBuf, uint16_t rxBufLen, uint16_t *rcvLen, SPI* mspiChannel, ST25R3911* mST25, DigitalOut* gpio_cs, InterruptIn* IRQ, DigitalOut* fieldLED_01, DigitalOut* fieldLED_02, DigitalOut* fieldLED_03, DigitalOut* fieldLED_04, DigitalOut* fieldLED_05, DigitalOut* fieldLED_06 );
+
+
+/*!
+ *****************************************************************************
+ * \brief  NFC-A T2T Poller Fast Read
+ *
+ * This method reads the pages from startPage to endPage (included) of a 
+ * NFC-A T2T Listener device with a single FAST_READ, unless all of them
+ * are on the page cache
+ *
+ * \param[in]   startPage : first page to be read
+ * \param[in]   endPage   : last page to be read
+ * \param[out]  rxBuf     : pointer to place the read data
+ * \param[in]   rxBufLen  : size of rxBuf
+ * \param[out]  rcvLen    : actual received data
+ *
+ * \return ERR_WRONG_STATE  : RFAL not initialized or mode not set
+ * \return ERR_PARAM        : Invalid parameter
+ * \return ERR_NOMEM        : rxBuf cannot hold the requested pages
+ * \return ERR_PROTO        : Protocol error, NAK received
+ * \return ERR_NONE         : No error
+ *****************************************************************************
+ */
+ReturnCode rfalT2TPollerFastRead( uint8_t startPage, uint8_t endPage, uint8_t* rxBuf, uint16_t rxBufLen, uint16_t *rcvLen, SPI* mspiChannel, ST25R3911* mST25, DigitalOut* gpio_cs, InterruptIn* IRQ, DigitalOut* fieldLED_01, DigitalOut* fieldLED_02, DigitalOut* fieldLED_03, DigitalOut* fieldLED_04, DigitalOut* fieldLED_05, DigitalOut* fieldLED_06 );
+
+
+/*!
+ *****************************************************************************
+ * \brief  NFC-A T2T Poller Write
+ *
+ * This method writes one page on a NFC-A T2T Listener device
+ *
+ * \param[in]   page      : page to be written
+ * \param[in]   wrData    : data to be written, RFAL_T2T_WRITE_DATA_LEN bytes
+ *
+ * \return ERR_WRONG_STATE  : RFAL not initialized or mode not set
+ * \return ERR_PARAM        : Invalid parameter
+ * \return ERR_PROTO        : Protocol error, NAK received
+ * \return ERR_NONE         : No error, ACK received
+ *****************************************************************************
+ */
+ReturnCode rfalT2TPollerWrite( uint8_t page, const uint8_t* wrData, SPI* mspiChannel, ST25R3911* mST25, DigitalOut* gpio_cs, InterruptIn* IRQ, DigitalOut* fieldLED_01, DigitalOut* fieldLED_02, DigitalOut* fieldLED_03, DigitalOut* fieldLED_04, DigitalOut* fieldLED_05, DigitalOut* fieldLED_06 );
+
+
+/*!
+ *****************************************************************************
+ * \brief  NFC-A T2T Poller Compatibility Write
+ *
+ * This method writes one page on a NFC-A T2T Listener device using the 
+ * two frames COMPATIBILITY_WRITE, the page is sent zero padded to 16 bytes
+ *
+ * \param[in]   page      : page to be written
+ * \param[in]   wrData    : data to be written, RFAL_T2T_WRITE_DATA_LEN bytes
+ *
+ * \return ERR_WRONG_STATE  : RFAL not initialized or mode not set
+ * \return ERR_PARAM        : Invalid parameter
+ * \return ERR_PROTO        : Protocol error, NAK received
+ * \return ERR_NONE         : No error, ACK received
+ *****************************************************************************
+ */
+ReturnCode rfalT2TPollerCompatibilityWrite( uint8_t page, const uint8_t* wrData, SPI* mspiChannel, ST25R3911* mST25, DigitalOut* gpio_cs, InterruptIn* IRQ, DigitalOut* fieldLED_01, DigitalOut* fieldLED_02, DigitalOut* fieldLED_03, DigitalOut* fieldLED_04, DigitalOut* fieldLED_05, DigitalOut* fieldLED_06 );
+
+
+/*!
+ *****************************************************************************
+ * \brief  NFC-A T2T Poller Get Version
+ *
+ * This method retrieves the product version of a NTAG21x/Ultralight EV1
+ *
+ * \param[out]  version   : pointer to place the GET_VERSION response
+ *
+ * \return ERR_WRONG_STATE  : RFAL not initialized or mode not set
+ * \return ERR_PARAM        : Invalid parameter
+ * \return ERR_PROTO        : Protocol error, NAK received
+ * \return ERR_NONE         : No error
+ *****************************************************************************
+ */
+ReturnCode rfalT2TPollerGetVersion( rfalT2TVersion *version, SPI* mspiChannel, ST25R3911* mST25, DigitalOut* gpio_cs, InterruptIn* IRQ, DigitalOut* fieldLED_01, DigitalOut* fieldLED_02, DigitalOut* fieldLED_03, DigitalOut* fieldLED_04, DigitalOut* fieldLED_05, DigitalOut* fieldLED_06 );
+
+
+/*!
+ *****************************************************************************
+ * \brief  NFC-A T2T Poller Read Signature
+ *
+ * This method reads the originality signature of a NTAG21x/Ultralight EV1
+ *
+ * \param[out]  signature : pointer to place the RFAL_T2T_SIGNATURE_LEN bytes signature
+ *
+ * \return ERR_WRONG_STATE  : RFAL not initialized or mode not set
+ * \return ERR_PARAM        : Invalid parameter
+ * \return ERR_PROTO        : Protocol error, NAK received
+ * \return ERR_NONE         : No error
+ *****************************************************************************
+ */
+ReturnCode rfalT2TPollerReadSignature( uint8_t *signature, SPI* mspiChannel, ST25R3911* mST25, DigitalOut* gpio_cs, InterruptIn* IRQ, DigitalOut* fieldLED_01, DigitalOut* fieldLED_02, DigitalOut* fieldLED_03, DigitalOut* fieldLED_04, DigitalOut* fieldLED_05, DigitalOut* fieldLED_06 );
+
+
+/*!
+ *****************************************************************************
+ * \brief  NFC-A T2T Cache Bind
+ *
+ * Binds the page cache to the device with the given UID. The cached pages
+ * are kept if the UID is the one already bound, dropped otherwise.
+ * The application must call rfalT2TCacheInvalidate() whenever the tag 
+ * may have been written by someone else (e.g. after it has been removed)
+ *
+ * READ rolls over to page 0 at the end of memory, so out of a READ only
+ * the pages below memPages are cached. If the size is unknown only the 
+ * first page of each READ is cached; FAST_READ is NAKed past the end of 
+ * memory and always cached
+ *
+ * \param[in]   uid       : UID of the device, NULL disables the cache
+ * \param[in]   uidLen    : UID length
+ * \param[in]   memPages  : number of pages of the device (e.g. from 
+ *                          GET_VERSION or the CC), 0 if unknown
+ *
+ * \return ERR_PARAM        : Invalid parameter
+ * \return ERR_NONE         : No error
+ *****************************************************************************
+ */
+ReturnCode rfalT2TCacheBind( const uint8_t *uid, uint8_t uidLen, uint16_t memPages );
+
+
+/*!
+ *****************************************************************************
+ * \brief  NFC-A T2T Cache Invalidate
+ *
+ * Drops all the cached pages, the cache stays bound to the same device
+ *****************************************************************************
+ */
+void rfalT2TCacheInvalidate( void );
+
+#endif /* RFAL_T2T_H */
+
+/**
+  * @}
+  *
+  * @}
+  *
+  * @}
+  */